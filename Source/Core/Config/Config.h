@@ -59,6 +59,40 @@ struct Config {
     int PortNumber = CONFIG_DEFAULT_PORT_NUMBER;                /**Sets the port number that the service is running on.*/
     std::string Host = CONFIG_DEFAULT_HOST;                     /**Sets the host that the service binds to*/
 
+    int BatchWorkerThreads = CONFIG_DEFAULT_BATCH_WORKER_THREADS; /**Number of workers used to run independent items of parallel EVM requests (0 = hardware concurrency)*/
+
+    int ComputeWorkerThreads = CONFIG_DEFAULT_COMPUTE_WORKER_THREADS; /**Number of workers for background jobs, also the number of heavy calls admitted at once (0 = hardware concurrency)*/
+
+    int RouteMaxConcurrent = CONFIG_DEFAULT_ROUTE_MAX_CONCURRENT;       /**Default number of calls per route that may run at once (0 = unlimited)*/
+    int RouteMaxQueued = CONFIG_DEFAULT_ROUTE_MAX_QUEUED;               /**Default number of calls per route that may wait for a free slot*/
+    int RouteQueueTimeout_ms = CONFIG_DEFAULT_ROUTE_QUEUE_TIMEOUT_MS;   /**Longest time a queued call waits before being answered with a busy status*/
+
+    int RequestCacheMaxEntries = CONFIG_DEFAULT_REQUEST_CACHE_MAX_ENTRIES; /**Number of ClientToken responses remembered for retries*/
+    int RequestCacheTTL_ms = CONFIG_DEFAULT_REQUEST_CACHE_TTL_MS;         /**Time after which a ClientToken response is forgotten*/
+
+    int ResultStoreMaxResults = CONFIG_DEFAULT_RESULT_STORE_MAX_RESULTS; /**Number of paged validation results kept at once, the oldest is dropped first*/
+    int ResultStoreTTL_ms = CONFIG_DEFAULT_RESULT_STORE_TTL_MS;          /**Time after the last page request at which a paged result is dropped*/
+
+    int LogMinLevel = CONFIG_DEFAULT_LOG_MIN_LEVEL;     /**Messages of the request paths below this level are discarded before being formatted*/
+    int LogQueueSize = CONFIG_DEFAULT_LOG_QUEUE_SIZE;   /**Number of log messages that may wait for the asynchronous sink before new ones are dropped*/
+
+    int EventFlushInterval_ms = CONFIG_DEFAULT_EVENT_FLUSH_INTERVAL_MS; /**Longest time a job event waits before being pushed to the API service*/
+    int EventMaxBatch = CONFIG_DEFAULT_EVENT_MAX_BATCH;                 /**Number of jobs with pending events that triggers an early push*/
+    int EventMaxRetries = CONFIG_DEFAULT_EVENT_MAX_RETRIES;             /**Failed pushes after which a job event is dropped*/
+    int EventMaxPending = CONFIG_DEFAULT_EVENT_MAX_PENDING;             /**Number of jobs with unsent events kept while the API service is unreachable*/
+
+    bool UseSharedMemoryTransport = CONFIG_DEFAULT_SHARED_MEMORY_TRANSPORT; /**Ask NES for bulk arrays in shared memory segments, only if NES runs on this host*/
+    int ConnectionPoolSize = CONFIG_DEFAULT_CONNECTION_POOL_SIZE; /**Number of connections kept to the upstream service, so concurrent validations do not share a socket*/
+    int IdleProbeInterval_ms = CONFIG_DEFAULT_IDLE_PROBE_INTERVAL_MS;       /**Connections are only probed after being idle this long, successful traffic counts as a heartbeat*/
+    int ReconnectBackoffMin_ms = CONFIG_DEFAULT_RECONNECT_BACKOFF_MIN_MS;   /**First delay before reconnecting, doubled with jitter after each failure*/
+    int ReconnectBackoffMax_ms = CONFIG_DEFAULT_RECONNECT_BACKOFF_MAX_MS;   /**Upper bound of the reconnect delay*/
+
+    std::vector<std::string> NESBackends;                   /**"host:port" of each NES backend simulations may be placed on, empty = use the API service callback*/
+    int NESTimeout_ms = CONFIG_DEFAULT_NES_TIMEOUT_MS;      /**RPC timeout used for the NES backends*/
+    bool SingleFlight = CONFIG_DEFAULT_SINGLE_FLIGHT;       /**Identical concurrent read-only queries share one round trip*/
+    bool Hedging = CONFIG_DEFAULT_HEDGING;                  /**Read-only queries slower than their route's p95 are duplicated on another connection*/
+    std::string SnapshotCacheDir = CONFIG_DEFAULT_SNAPSHOT_CACHE_DIR; /**Directory of the on-disk cache of fetched simulation data, empty = no cache*/
+
     ProfilingStatus ProfilingStatus_ = PROFILE_NONE;            /**Enum with some preconfigured profiling charastics for us to test when needed*/
 
 
@@ -23,4 +23,28 @@
 #define CONFIG_DEFAULT_CFG_FILE_PATH1 "EVM.yaml"
 #define CONFIG_DEFAULT_CFG_FILE_PATH2 "/etc/BrainGenix/EVM/EVM.yaml"
 #define CONFIG_DEFAULT_PORT_NUMBER 8002
-#define CONFIG_DEFAULT_HOST "0.0.0.0"
\ No newline at end of file
+#define CONFIG_DEFAULT_HOST "0.0.0.0"
+#define CONFIG_DEFAULT_BATCH_WORKER_THREADS 0 // 0 means use std::thread::hardware_concurrency()
+#define CONFIG_DEFAULT_COMPUTE_WORKER_THREADS 0 // 0 means use std::thread::hardware_concurrency()
+#define CONFIG_DEFAULT_ROUTE_MAX_CONCURRENT 0 // 0 means unlimited
+#define CONFIG_DEFAULT_ROUTE_MAX_QUEUED 0
+#define CONFIG_DEFAULT_ROUTE_QUEUE_TIMEOUT_MS 1000
+#define CONFIG_DEFAULT_REQUEST_CACHE_MAX_ENTRIES 1024
+#define CONFIG_DEFAULT_REQUEST_CACHE_TTL_MS 300000
+#define CONFIG_DEFAULT_RESULT_STORE_MAX_RESULTS 64
+#define CONFIG_DEFAULT_RESULT_STORE_TTL_MS 600000
+#define CONFIG_DEFAULT_LOG_MIN_LEVEL 0
+#define CONFIG_DEFAULT_LOG_QUEUE_SIZE 4096
+#define CONFIG_DEFAULT_EVENT_FLUSH_INTERVAL_MS 250
+#define CONFIG_DEFAULT_EVENT_MAX_BATCH 64
+#define CONFIG_DEFAULT_EVENT_MAX_RETRIES 5
+#define CONFIG_DEFAULT_EVENT_MAX_PENDING 1024
+#define CONFIG_DEFAULT_SHARED_MEMORY_TRANSPORT false
+#define CONFIG_DEFAULT_CONNECTION_POOL_SIZE 4
+#define CONFIG_DEFAULT_IDLE_PROBE_INTERVAL_MS 2000
+#define CONFIG_DEFAULT_RECONNECT_BACKOFF_MIN_MS 500
+#define CONFIG_DEFAULT_RECONNECT_BACKOFF_MAX_MS 30000
+#define CONFIG_DEFAULT_NES_TIMEOUT_MS 2500
+#define CONFIG_DEFAULT_SINGLE_FLIGHT true
+#define CONFIG_DEFAULT_HEDGING false
+#define CONFIG_DEFAULT_SNAPSHOT_CACHE_DIR ""
@@ -47,6 +47,83 @@ ConfigFileParser::ConfigFileParser(Config &_Config) {
     _Config.PortNumber = Config["Network_EVM_API_Port"].as<int>();
     _Config.Host = Config["Network_EVM_API_Host"].as<std::string>();
 
+    // Optional tuning parameters, older configuration files may not have these
+    if (Config["Threads_EVM_BatchWorkers"]) {
+        _Config.BatchWorkerThreads = Config["Threads_EVM_BatchWorkers"].as<int>();
+    }
+    if (Config["Threads_EVM_ComputeWorkers"]) {
+        _Config.ComputeWorkerThreads = Config["Threads_EVM_ComputeWorkers"].as<int>();
+    }
+    if (Config["Admission_RouteMaxConcurrent"]) {
+        _Config.RouteMaxConcurrent = Config["Admission_RouteMaxConcurrent"].as<int>();
+    }
+    if (Config["Admission_RouteMaxQueued"]) {
+        _Config.RouteMaxQueued = Config["Admission_RouteMaxQueued"].as<int>();
+    }
+    if (Config["Admission_RouteQueueTimeout_ms"]) {
+        _Config.RouteQueueTimeout_ms = Config["Admission_RouteQueueTimeout_ms"].as<int>();
+    }
+    if (Config["Cache_RequestMaxEntries"]) {
+        _Config.RequestCacheMaxEntries = Config["Cache_RequestMaxEntries"].as<int>();
+    }
+    if (Config["Cache_RequestTTL_ms"]) {
+        _Config.RequestCacheTTL_ms = Config["Cache_RequestTTL_ms"].as<int>();
+    }
+    if (Config["Cache_ResultMaxResults"]) {
+        _Config.ResultStoreMaxResults = Config["Cache_ResultMaxResults"].as<int>();
+    }
+    if (Config["Cache_ResultTTL_ms"]) {
+        _Config.ResultStoreTTL_ms = Config["Cache_ResultTTL_ms"].as<int>();
+    }
+    if (Config["Logging_MinLevel"]) {
+        _Config.LogMinLevel = Config["Logging_MinLevel"].as<int>();
+    }
+    if (Config["Logging_QueueSize"]) {
+        _Config.LogQueueSize = Config["Logging_QueueSize"].as<int>();
+    }
+    if (Config["Events_FlushInterval_ms"]) {
+        _Config.EventFlushInterval_ms = Config["Events_FlushInterval_ms"].as<int>();
+    }
+    if (Config["Events_MaxBatch"]) {
+        _Config.EventMaxBatch = Config["Events_MaxBatch"].as<int>();
+    }
+    if (Config["Events_MaxRetries"]) {
+        _Config.EventMaxRetries = Config["Events_MaxRetries"].as<int>();
+    }
+    if (Config["Events_MaxPending"]) {
+        _Config.EventMaxPending = Config["Events_MaxPending"].as<int>();
+    }
+    if (Config["NES_SharedMemoryTransport"]) {
+        _Config.UseSharedMemoryTransport = Config["NES_SharedMemoryTransport"].as<bool>();
+    }
+    if (Config["NES_ConnectionPoolSize"]) {
+        _Config.ConnectionPoolSize = Config["NES_ConnectionPoolSize"].as<int>();
+    }
+    if (Config["NES_IdleProbeInterval_ms"]) {
+        _Config.IdleProbeInterval_ms = Config["NES_IdleProbeInterval_ms"].as<int>();
+    }
+    if (Config["NES_ReconnectBackoffMin_ms"]) {
+        _Config.ReconnectBackoffMin_ms = Config["NES_ReconnectBackoffMin_ms"].as<int>();
+    }
+    if (Config["NES_ReconnectBackoffMax_ms"]) {
+        _Config.ReconnectBackoffMax_ms = Config["NES_ReconnectBackoffMax_ms"].as<int>();
+    }
+    if (Config["NES_Backends"]) {
+        _Config.NESBackends = Config["NES_Backends"].as<std::vector<std::string>>();
+    }
+    if (Config["NES_Timeout_ms"]) {
+        _Config.NESTimeout_ms = Config["NES_Timeout_ms"].as<int>();
+    }
+    if (Config["NES_SingleFlight"]) {
+        _Config.SingleFlight = Config["NES_SingleFlight"].as<bool>();
+    }
+    if (Config["NES_Hedging"]) {
+        _Config.Hedging = Config["NES_Hedging"].as<bool>();
+    }
+    if (Config["NES_SnapshotCacheDir"]) {
+        _Config.SnapshotCacheDir = Config["NES_SnapshotCacheDir"].as<std::string>();
+    }
+
 }
 
 
@@ -25,6 +25,11 @@ int main(int NumArguments, char** ArgumentValues) {
     // Setup API Server
     BG::EVM::API::RPCManager APIManager(&SystemConfiguration, &Logger);
 
+    // Setup Validation Routes
+    BG::ValidationRPCInterface ValidationInterface(&Logger, &APIManager);
+
+    // Every route is registered, start serving
+    APIManager.Start();
 
 
     // Print ASCII BrainGenix Logo To Console
@@ -30,6 +30,8 @@
 #include <Config/Config.h>
 #include <RPC/RPCManager.h>
 
+#include <Validation/ValidationRPCInterface.h>
+
 // #include <Simulator/RPC/SimulationRPCInterface.h>
 // #include <Simulator/RPC/GeometryRPCInterface.h>
 // #include <Simulator/RPC/ModelRPCInterface.h>
@@ -14,11 +14,12 @@
 #include <vector>
 
 // Third-Party Libraries (BG convention: use <> instead of "")
-//#include <nlohmann/json.hpp>
+#include <nlohmann/json.hpp>
 
 
 // Internal Libraries (BG convention: use <> instead of "")
-#include <RPC/SafeClient.h>
+#include <NESInteraction/NESRouter.h>
+#include <NESInteraction/NESDataFetch.h>
 
 
 namespace BG {
@@ -32,15 +33,30 @@ namespace BG {
  */
 class N1Metrics {
 protected:
-    SafeClient & Client_;
-    int KGTSimID_ = -1;
-    int EmuSimID_ = -1;
+    NESSim KGTSim_;
+    NESSim EmuSim_;
+    const SimDataset& KGTData_; /**Prefetched data of the ground-truth system, holds at least RequiredFields*/
+    const SimDataset& EmuData_; /**Prefetched data of the emulation system, holds at least RequiredFields*/
     const std::vector<int>& KGT2Emu_;
 public:
-    N1Metrics(SafeClient & _Client, int _KGTSimID, int _EmuSimID, const std::vector<int>& _KGT2Emu):
-        Client_(_Client), KGTSimID_(_KGTSimID), EmuSimID_(_EmuSimID), KGT2Emu_(_KGT2Emu) {}
-
-    bool Validate();
+    /**
+     * NESDataField bits the metrics read from the prefetched datasets.
+     * The metrics only use those datasets: a system served from the snapshot cache is not loaded in NES.
+     * *** Add the fields here as the metrics are implemented (e.g. NES_DATA_CONNECTIVITY).
+     */
+    static constexpr unsigned RequiredFields = 0;
+
+    N1Metrics(const NESSim & _KGTSim, const NESSim & _EmuSim, const SimDataset & _KGTData, const SimDataset & _EmuData, const std::vector<int>& _KGT2Emu):
+        KGTSim_(_KGTSim), EmuSim_(_EmuSim), KGTData_(_KGTData), EmuData_(_EmuData), KGT2Emu_(_KGT2Emu) {}
+
+    /**
+     * Applies the metrics and appends one record per ground-truth neuron to _PerNeuronResults.
+     * *** Not implemented yet, nothing is appended and false is returned.
+     * 
+     * @param _PerNeuronResults JSON array to which the per-neuron records are appended.
+     * @return True if successfully carried out.
+     */
+    bool Validate(nlohmann::json & _PerNeuronResults);
 
 };
 
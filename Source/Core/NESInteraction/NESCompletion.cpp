@@ -0,0 +1,43 @@
+//=================================//
+// This file is part of BrainGenix //
+//=================================//
+
+
+// Standard Libraries (BG convention: use <> instead of "")
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <NESInteraction/NESCompletion.h>
+
+namespace BG {
+
+
+void NESCompletionSignal::Notify(const SafeClient* _From) {
+	{
+		std::lock_guard<std::mutex> Lock(Mutex_);
+		Generation_++;
+		if (_From != nullptr) {
+			CallbackClients_.insert(_From);
+		}
+	}
+	Condition_.notify_all();
+}
+
+std::uint64_t NESCompletionSignal::GetGeneration() {
+	std::lock_guard<std::mutex> Lock(Mutex_);
+	return Generation_;
+}
+
+bool NESCompletionSignal::WaitForNotification(std::uint64_t _Since, std::chrono::steady_clock::time_point _Until) {
+	std::unique_lock<std::mutex> Lock(Mutex_);
+	return Condition_.wait_until(Lock, _Until, [&]() { return Generation_ != _Since; });
+}
+
+bool NESCompletionSignal::HasCallbacks(const SafeClient* _Client) {
+	std::lock_guard<std::mutex> Lock(Mutex_);
+	return CallbackClients_.count(_Client) > 0;
+}
+
+
+} // BG
@@ -0,0 +1,81 @@
+//===========================================================//
+// This file is part of the BrainGenix-EVM Validation System //
+//===========================================================//
+
+/*
+    Description: This file provides the signal through which NES completion callbacks wake waiting loads.
+    Additional Notes: None
+    Date Created: 2024-06-20
+*/
+
+#pragma once
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <set>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+
+// Internal Libraries (BG convention: use <> instead of "")
+
+
+namespace BG {
+
+class SafeClient;
+
+
+/**
+ * Signalled whenever NES reports (through EVM's "NESCompleted" route) that a
+ * process finished. It carries no result, waiters re-query the status of their
+ * own backend when woken, so a callback from any backend is harmless to others.
+ *
+ * Usage: take GetGeneration() before querying the status, then wait with that
+ * value, so a callback that arrives in between is not missed.
+ *
+ * Whether NES calls back is remembered per backend (by its client), so a backend
+ * that does not call back keeps being polled at the normal rate.
+ */
+class NESCompletionSignal {
+
+private:
+
+    std::mutex Mutex_; /**Protects Generation_ for the condition variable*/
+    std::condition_variable Condition_; /**Notified on every completion*/
+    std::uint64_t Generation_ = 0; /**Number of completions signalled so far*/
+    std::set<const SafeClient*> CallbackClients_; /**Backends known to call back, protected by Mutex_*/
+
+public:
+
+    /**
+     * @brief Records a completion and wakes all waiters.
+     * 
+     * @param _From Client of the backend that called back, nullptr if it is not known.
+     */
+    void Notify(const SafeClient* _From = nullptr);
+
+    /**
+     * @brief Returns the number of completions so far, pass it to WaitForNotification().
+     */
+    std::uint64_t GetGeneration();
+
+    /**
+     * @brief Waits until a completion newer than _Since is signalled, or until _Until.
+     * 
+     * @param _Since Value of GetGeneration() taken before the last status query.
+     * @param _Until Latest time to return.
+     * @return true if woken by a completion.
+     */
+    bool WaitForNotification(std::uint64_t _Since, std::chrono::steady_clock::time_point _Until);
+
+    /**
+     * @brief Returns true if the given backend has called back at least once, so polling it only needs to be a safety net.
+     */
+    bool HasCallbacks(const SafeClient* _Client);
+
+};
+
+
+} // BG
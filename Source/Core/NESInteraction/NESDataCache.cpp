@@ -0,0 +1,300 @@
+//=================================//
+// This file is part of BrainGenix //
+//=================================//
+
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <unistd.h>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <NESInteraction/NESDataCache.h>
+#include <Util/SharedMemory.h>
+
+
+// Layout of a snapshot file (native byte order, the cache is local to the host):
+//   SnapshotHeader | SnapshotEntry[NumArrays] | save name | fingerprint | padding | arrays, each 64-byte aligned
+#define SNAPSHOT_MAGIC "BGSNAP01"
+#define SNAPSHOT_ALIGNMENT 64
+#define SNAPSHOT_FILE_EXTENSION ".bgsnap"
+
+namespace BG {
+
+struct SnapshotHeader {
+	char Magic_[8];
+	std::uint32_t Fields_;           /**NESDataField bits stored*/
+	std::uint32_t NumArrays_;        /**Entries in the table*/
+	std::uint32_t SaveNameLength_;   /**Bytes of the save name following the table*/
+	std::uint32_t FingerprintLength_;/**Bytes of the fingerprint following the save name*/
+};
+
+struct SnapshotEntry {
+	std::uint32_t Slot_;       /**Which array of the SimDataset, see ForEachArray()*/
+	std::uint32_t ElementSize_;/**sizeof the element type, checked on load*/
+	std::uint64_t Offset_;     /**Byte offset of the values in the file*/
+	std::uint64_t Count_;      /**Number of values*/
+};
+
+
+/**
+ * Calls _Function(Slot, Field, Array) for every array of a dataset, the slot numbers are part of the file format.
+ */
+template <typename DatasetType, typename FunctionType>
+static void ForEachArray(DatasetType& _Dataset, FunctionType _Function) {
+	_Function(0, NES_DATA_SOMA_POSITIONS, _Dataset.SomaPositions_);
+	_Function(1, NES_DATA_NEURON_TYPES, _Dataset.NeuronTypes_);
+	_Function(2, NES_DATA_CONNECTIVITY, _Dataset.ConnectionPairs_);
+	_Function(3, NES_DATA_COMPARTMENTS, _Dataset.CompartmentPositions_);
+	_Function(4, NES_DATA_COMPARTMENTS, _Dataset.CompartmentNeurons_);
+	_Function(5, NES_DATA_RECORDINGS, _Dataset.RecordingTimes_ms_);
+	_Function(6, NES_DATA_RECORDINGS, _Dataset.Recording_);
+}
+
+static std::uint64_t AlignUp(std::uint64_t _Offset) {
+	return (_Offset + SNAPSHOT_ALIGNMENT - 1) / SNAPSHOT_ALIGNMENT * SNAPSHOT_ALIGNMENT;
+}
+
+/**
+ * FNV-1a, only used to turn the key into a file name, the full key is stored in and checked against the file.
+ */
+static std::uint64_t HashKey(const std::string& _SaveName, const std::string& _Fingerprint) {
+	std::uint64_t Hash = 14695981039346656037ull;
+	auto Mix = [&Hash](const std::string& _Text) {
+		for (unsigned char Character : _Text) {
+			Hash = (Hash ^ Character) * 1099511628211ull;
+		}
+		Hash = (Hash ^ 0xff) * 1099511628211ull; // Separator, so ("ab","c") and ("a","bc") differ
+	};
+	Mix(_SaveName);
+	Mix(_Fingerprint);
+	return Hash;
+}
+
+
+NESDataCache::NESDataCache(BG::Common::Logger::LoggingSystem* _Logger, const std::string& _Directory) {
+	Logger_ = _Logger;
+	Directory_ = _Directory;
+	NextTemporary_ = 0;
+
+	std::error_code Error;
+	std::filesystem::create_directories(Directory_, Error);
+	if (Error) {
+		_Logger->Log("Cannot Create Snapshot Cache Directory '" + Directory_ + "': " + Error.message(), 7);
+	} else {
+		_Logger->Log("Caching Simulation Data In '" + Directory_ + "'", 4);
+	}
+}
+
+/**
+ * Readable part of the file names of a save, several saves may share it.
+ */
+static std::string GetReadableName(const std::string& _SaveName) {
+	std::string Readable;
+	for (char Character : _SaveName) {
+		if (Readable.size() >= 48) {
+			break;
+		}
+		bool Plain = (Character >= 'a' && Character <= 'z') || (Character >= 'A' && Character <= 'Z') || (Character >= '0' && Character <= '9') || Character == '-' || Character == '_';
+		Readable += Plain ? Character : '_';
+	}
+	return Readable;
+}
+
+/**
+ * Checks whether a file is a snapshot of the given save, of any fingerprint.
+ */
+static bool IsSnapshotOf(const std::string& _Path, const std::string& _SaveName) {
+	std::ifstream File(_Path, std::ios::binary);
+	SnapshotHeader Header;
+	if (!File.read(reinterpret_cast<char*>(&Header), sizeof(Header)) || std::memcmp(Header.Magic_, SNAPSHOT_MAGIC, sizeof(Header.Magic_)) != 0
+		|| Header.SaveNameLength_ != _SaveName.size()) {
+		return false;
+	}
+	std::string SaveName(_SaveName.size(), '\0');
+	File.seekg(std::streamoff(sizeof(Header) + std::uint64_t(Header.NumArrays_) * sizeof(SnapshotEntry)));
+	return File.read(&SaveName[0], std::streamsize(SaveName.size())) && SaveName == _SaveName;
+}
+
+
+std::string NESDataCache::GetPath(const std::string& _SaveName, const std::string& _Fingerprint) const {
+
+	// Keep a readable part of the save name, the hash makes the name unique
+	char Hash[17];
+	std::snprintf(Hash, sizeof(Hash), "%016llx", static_cast<unsigned long long>(HashKey(_SaveName, _Fingerprint)));
+	return Directory_ + "/" + GetReadableName(_SaveName) + "-" + Hash + SNAPSHOT_FILE_EXTENSION;
+}
+
+
+void NESDataCache::RemoveOtherSnapshots(const std::string& _SaveName, const std::string& _Path) {
+
+	// Only files sharing the readable part can belong to the save, the stored name decides
+	std::string Prefix = GetReadableName(_SaveName) + "-";
+	std::string Extension = SNAPSHOT_FILE_EXTENSION;
+	std::error_code Error;
+	for (const std::filesystem::directory_entry& Entry : std::filesystem::directory_iterator(Directory_, Error)) {
+		std::string Name = Entry.path().filename().string();
+		if (Name.size() < Prefix.size() + Extension.size() || Name.compare(0, Prefix.size(), Prefix) != 0
+			|| Name.compare(Name.size() - Extension.size(), Extension.size(), Extension) != 0) {
+			continue;
+		}
+		std::string Path = Directory_ + "/" + Name;
+		if (Path == _Path || !IsSnapshotOf(Path, _SaveName)) {
+			continue;
+		}
+
+		// Readers that still have it mapped keep their view, the space is freed once they are done
+		if (std::remove(Path.c_str()) == 0) {
+			Logger_->Log("Removed Outdated Snapshot '" + Path + "'", 3);
+		}
+	}
+}
+
+
+bool NESDataCache::Load(const std::string& _SaveName, const std::string& _Fingerprint, unsigned _Fields, SimDataset& _Dataset) {
+
+	std::string Path = GetPath(_SaveName, _Fingerprint);
+	std::shared_ptr<EVM::Util::SharedMemoryView> View = std::make_shared<EVM::Util::SharedMemoryView>();
+	if (!View->MapFile(Path)) {
+		return false; // Not cached yet
+	}
+
+	// Check everything before pointing any array into the mapping
+	const char* Data = static_cast<const char*>(View->Data());
+	std::uint64_t Size = View->Size();
+	SnapshotHeader Header;
+	if (Size < sizeof(Header)) {
+		Logger_->Log("Ignoring Truncated Snapshot '" + Path + "'", 6);
+		return false;
+	}
+	std::memcpy(&Header, Data, sizeof(Header));
+	std::uint64_t TableEnd = sizeof(Header) + std::uint64_t(Header.NumArrays_) * sizeof(SnapshotEntry);
+	if (std::memcmp(Header.Magic_, SNAPSHOT_MAGIC, sizeof(Header.Magic_)) != 0 || TableEnd + Header.SaveNameLength_ + Header.FingerprintLength_ > Size) {
+		Logger_->Log("Ignoring Invalid Snapshot '" + Path + "'", 6);
+		return false;
+	}
+	const char* Key = Data + TableEnd;
+	if (std::string(Key, Header.SaveNameLength_) != _SaveName || std::string(Key + Header.SaveNameLength_, Header.FingerprintLength_) != _Fingerprint) {
+		return false; // Hash collision, or the file belongs to another key
+	}
+	if ((Header.Fields_ & _Fields) != _Fields) {
+		return false; // Has fewer fields than needed, the caller fetches and replaces it
+	}
+
+	std::vector<SnapshotEntry> Entries(Header.NumArrays_);
+	if (!Entries.empty()) {
+		std::memcpy(Entries.data(), Data + sizeof(Header), Entries.size() * sizeof(SnapshotEntry));
+	}
+
+	SimDataset Loaded;
+	bool Valid = true;
+	ForEachArray(Loaded, [&](std::uint32_t _Slot, unsigned _Field, auto& _Array) {
+		typedef typename std::remove_reference<decltype(_Array[0])>::type ConstElement;
+		typedef typename std::remove_const<ConstElement>::type Element;
+		if ((Header.Fields_ & _Field) == 0) {
+			return;
+		}
+		for (const SnapshotEntry& Entry : Entries) {
+			if (Entry.Slot_ != _Slot) {
+				continue;
+			}
+			if (Entry.ElementSize_ != sizeof(Element) || Entry.Offset_ % alignof(Element) != 0 || Entry.Offset_ > Size || Entry.Count_ > (Size - Entry.Offset_) / sizeof(Element)) {
+				Valid = false;
+				return;
+			}
+			_Array.AssignView(View, reinterpret_cast<const Element*>(Data + Entry.Offset_), size_t(Entry.Count_));
+			return;
+		}
+		Valid = false; // A stored field is missing one of its arrays
+	});
+	if (!Valid) {
+		Logger_->Log("Ignoring Invalid Snapshot '" + Path + "'", 6);
+		return false;
+	}
+
+	Loaded.Fields_ = Header.Fields_;
+	_Dataset = std::move(Loaded);
+	return true;
+}
+
+
+bool NESDataCache::Store(const std::string& _SaveName, const std::string& _Fingerprint, const SimDataset& _Dataset) {
+
+	// Lay out the table first, the arrays follow the key
+	SnapshotHeader Header;
+	std::memcpy(Header.Magic_, SNAPSHOT_MAGIC, sizeof(Header.Magic_));
+	Header.Fields_ = _Dataset.Fields_;
+	Header.SaveNameLength_ = std::uint32_t(_SaveName.size());
+	Header.FingerprintLength_ = std::uint32_t(_Fingerprint.size());
+
+	std::vector<SnapshotEntry> Entries;
+	std::vector<const void*> Sources;
+	ForEachArray(_Dataset, [&](std::uint32_t _Slot, unsigned _Field, const auto& _Array) {
+		if ((_Dataset.Fields_ & _Field) == 0) {
+			return;
+		}
+		SnapshotEntry Entry;
+		Entry.Slot_ = _Slot;
+		Entry.ElementSize_ = std::uint32_t(sizeof(_Array[0]));
+		Entry.Offset_ = 0;
+		Entry.Count_ = _Array.size();
+		Entries.push_back(Entry);
+		Sources.push_back(_Array.data());
+	});
+	Header.NumArrays_ = std::uint32_t(Entries.size());
+
+	std::uint64_t Offset = sizeof(Header) + Entries.size() * sizeof(SnapshotEntry) + _SaveName.size() + _Fingerprint.size();
+	for (SnapshotEntry& Entry : Entries) {
+		Offset = AlignUp(Offset);
+		Entry.Offset_ = Offset;
+		Offset += Entry.Count_ * Entry.ElementSize_;
+	}
+
+	// Write under a temporary name, then move it into place in one step
+	std::string Path = GetPath(_SaveName, _Fingerprint);
+	std::string Temporary = Path + ".tmp." + std::to_string(getpid()) + "." + std::to_string(NextTemporary_++);
+	{
+		std::ofstream File(Temporary, std::ios::binary | std::ios::trunc);
+		static const char Padding[SNAPSHOT_ALIGNMENT] = {};
+		File.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+		if (!Entries.empty()) {
+			File.write(reinterpret_cast<const char*>(Entries.data()), Entries.size() * sizeof(SnapshotEntry));
+		}
+		File.write(_SaveName.data(), _SaveName.size());
+		File.write(_Fingerprint.data(), _Fingerprint.size());
+		std::uint64_t Written = sizeof(Header) + Entries.size() * sizeof(SnapshotEntry) + _SaveName.size() + _Fingerprint.size();
+		for (size_t i = 0; i < Entries.size(); i++) {
+			File.write(Padding, std::streamsize(Entries[i].Offset_ - Written));
+			File.write(static_cast<const char*>(Sources[i]), std::streamsize(Entries[i].Count_ * Entries[i].ElementSize_));
+			Written = Entries[i].Offset_ + Entries[i].Count_ * Entries[i].ElementSize_;
+		}
+		File.flush();
+		if (!File) {
+			Logger_->Log("Failed To Write Snapshot '" + Temporary + "'", 7);
+			std::remove(Temporary.c_str());
+			return false;
+		}
+	}
+	if (std::rename(Temporary.c_str(), Path.c_str()) != 0) {
+		Logger_->Log("Failed To Move Snapshot Into Place At '" + Path + "'", 7);
+		std::remove(Temporary.c_str());
+		return false;
+	}
+
+	Logger_->Log("Cached Data Of '" + _SaveName + "' In '" + Path + "'", 3);
+
+	// A save only ever has one current fingerprint, so snapshots of its earlier versions are never hit again
+	RemoveOtherSnapshots(_SaveName, Path);
+	return true;
+}
+
+} // BG
@@ -0,0 +1,96 @@
+//===========================================================//
+// This file is part of the BrainGenix-EVM Validation System //
+//===========================================================//
+
+/*
+    Description: This file provides the on-disk cache of fetched simulation data.
+    Additional Notes: None
+    Date Created: 2024-06-26
+*/
+
+#pragma once
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <atomic>
+#include <string>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <NESInteraction/NESDataFetch.h>
+
+#include <BG/Common/Logger/Logger.h>
+
+
+namespace BG {
+
+
+/**
+ * Keeps snapshots of fetched simulation data on local disk, so that systems
+ * validated again and again (typically a ground-truth system against many
+ * emulation candidates) are neither loaded in NES nor transferred again.
+ *
+ * A snapshot is keyed by the save name and the fingerprint NES reports for
+ * that save (see GetNESSaveFingerprints()), so a changed save is never served
+ * from the cache. Each snapshot is one file: a small header and table followed
+ * by the raw arrays, 64-byte aligned, so loading maps the file and the arrays
+ * of the SimDataset point straight into the mapping.
+ *
+ * Files are written to a temporary name and renamed into place, so concurrent
+ * runs, and readers that still have an older snapshot mapped, are safe. Storing
+ * a new fingerprint of a save deletes the snapshots of its older fingerprints,
+ * so the directory holds at most one snapshot per save.
+ */
+class NESDataCache {
+
+private:
+
+    BG::Common::Logger::LoggingSystem* Logger_ = nullptr; /**Pointer to the instance of the logging system*/
+    std::string Directory_; /**Directory holding the snapshot files*/
+    std::atomic<unsigned> NextTemporary_; /**Makes temporary file names unique within this process*/
+
+    /**
+     * @brief Returns the path of the snapshot file of a save name and fingerprint.
+     */
+    std::string GetPath(const std::string& _SaveName, const std::string& _Fingerprint) const;
+
+    /**
+     * @brief Deletes the snapshots of a save other than the one at _Path, i.e. those of older fingerprints.
+     */
+    void RemoveOtherSnapshots(const std::string& _SaveName, const std::string& _Path);
+
+public:
+
+    /**
+     * @brief Construct a new NESDataCache object, creating the directory if needed.
+     * 
+     * @param _Logger Pointer to the logging system instance.
+     * @param _Directory Directory holding the snapshot files.
+     */
+    NESDataCache(BG::Common::Logger::LoggingSystem* _Logger, const std::string& _Directory);
+
+    /**
+     * @brief Maps the snapshot of a save if there is one that holds all requested fields.
+     * 
+     * @param _SaveName Save name of the system.
+     * @param _Fingerprint Fingerprint NES reports for the save.
+     * @param _Fields NESDataField bits that are needed.
+     * @param _Dataset Receives the arrays (read from the mapped file) and the fields of the snapshot.
+     * @return true on a hit, false if there is no valid snapshot covering _Fields.
+     */
+    bool Load(const std::string& _SaveName, const std::string& _Fingerprint, unsigned _Fields, SimDataset& _Dataset);
+
+    /**
+     * @brief Writes (or replaces) the snapshot of a save, deleting its snapshots of other fingerprints.
+     * 
+     * @param _SaveName Save name of the system.
+     * @param _Fingerprint Fingerprint NES reports for the save.
+     * @param _Dataset Fetched data, the fields in its Fields_ are stored.
+     * @return true on success, a failure only means the next run fetches again.
+     */
+    bool Store(const std::string& _SaveName, const std::string& _Fingerprint, const SimDataset& _Dataset);
+
+};
+
+
+} // BG
@@ -0,0 +1,193 @@
+//=================================//
+// This file is part of BrainGenix //
+//=================================//
+
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <string>
+#include <vector>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+#include <nlohmann/json.hpp>
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <NESInteraction/NESDataFetch.h>
+
+namespace BG {
+
+/**
+ * Request name of each field, in NESDataField bit order.
+ */
+static const char* const FieldRequests[] = {
+	"Simulation/GetSomaPositions",
+	"Simulation/GetNeuronTypes",
+	"Simulation/GetConnectivity",
+	"Simulation/GetCompartments",
+	"Simulation/GetRecording"
+};
+static const unsigned NumFields = sizeof(FieldRequests) / sizeof(FieldRequests[0]);
+
+
+/**
+ * Parses only the small parts of a batched response: ReqID, StatusCode and shared memory descriptors.
+ * Inline bulk arrays are skipped here (left out or marked discarded) and decoded from the raw text afterwards.
+ */
+static nlohmann::json ParseResponseSkeleton(const std::string& _Response) {
+	return nlohmann::json::parse(_Response, [](int _Depth, nlohmann::json::parse_event_t _Event, nlohmann::json&) {
+		return !(_Event == nlohmann::json::parse_event_t::array_start && _Depth >= 2);
+	}, false);
+}
+
+/**
+ * Decodes one array of the response element at the given position, logging what is missing.
+ * Descriptors are in the skeleton already, inline arrays are read from the raw response by JSON pointer.
+ */
+template <typename T>
+static bool DecodeField(BG::Common::Logger::LoggingSystem* _Logger, const std::string& _Response, size_t _Position, const nlohmann::json& _Element, const char* _Key, EVM::Util::BulkArray<T>& _Out) {
+	auto Iterator = _Element.find(_Key);
+	bool Decoded = (Iterator != _Element.end() && Iterator->is_object())
+		? EVM::Util::DecodeBulkArray(Iterator.value(), _Out)
+		: EVM::Util::DecodeBulkArray(_Response, "/" + std::to_string(_Position) + "/" + _Key, _Out);
+	if (!Decoded) {
+		_Logger->Log(std::string("Missing or invalid '") + _Key + "' in NES response", 7);
+		return false;
+	}
+	return true;
+}
+
+/**
+ * Decodes the response to the request of the given field.
+ */
+static bool DecodeResponse(BG::Common::Logger::LoggingSystem* _Logger, unsigned _Field, const std::string& _Response, size_t _Position, const nlohmann::json& _Element, SimDataset& _Dataset) {
+	switch (_Field) {
+		case NES_DATA_SOMA_POSITIONS:
+			return DecodeField(_Logger, _Response, _Position, _Element, "SomaPositions", _Dataset.SomaPositions_);
+		case NES_DATA_NEURON_TYPES:
+			return DecodeField(_Logger, _Response, _Position, _Element, "NeuronTypes", _Dataset.NeuronTypes_);
+		case NES_DATA_CONNECTIVITY:
+			return DecodeField(_Logger, _Response, _Position, _Element, "ConnectionPairs", _Dataset.ConnectionPairs_);
+		case NES_DATA_COMPARTMENTS:
+			return DecodeField(_Logger, _Response, _Position, _Element, "CompartmentPositions", _Dataset.CompartmentPositions_)
+				&& DecodeField(_Logger, _Response, _Position, _Element, "CompartmentNeurons", _Dataset.CompartmentNeurons_);
+		case NES_DATA_RECORDINGS:
+			return DecodeField(_Logger, _Response, _Position, _Element, "RecordingTimes_ms", _Dataset.RecordingTimes_ms_)
+				&& DecodeField(_Logger, _Response, _Position, _Element, "Recording", _Dataset.Recording_);
+	}
+	return false;
+}
+
+
+bool FetchSimDataset(BG::Common::Logger::LoggingSystem* _Logger, const NESSim & _Sim, unsigned _Fields, SimDataset & _Dataset) {
+
+	_Dataset.Fields_ = 0;
+	if (_Fields == 0) {
+		return true;
+	}
+	if ((_Fields >> NumFields) != 0) {
+		_Logger->Log("Unknown NES data field requested: " + std::to_string(_Fields), 7);
+		return false;
+	}
+
+	// One request per field, the ReqID is the field's position in the batch
+	nlohmann::json Params;
+	Params["SimID"] = _Sim.SimID_;
+	if (_Sim.Client_->UsesSharedMemoryTransport()) {
+		Params["BulkTransport"] = "SHM"; // Bulk arrays then come as shared memory segments
+	}
+	nlohmann::json Batch = nlohmann::json::array();
+	std::vector<unsigned> BatchFields;
+	for (unsigned i = 0; i < NumFields; i++) {
+		unsigned Field = 1u << i;
+		if ((_Fields & Field) == 0) {
+			continue;
+		}
+		nlohmann::json Request;
+		Request["ReqID"] = BatchFields.size();
+		Request[FieldRequests[i]] = Params;
+		Batch.push_back(std::move(Request));
+		BatchFields.push_back(Field);
+	}
+
+	// A lone request goes to its own (read-only) route, mixed batches to the generic one
+	std::string Route = (BatchFields.size() == 1) ? FieldRequests[__builtin_ctz(_Fields)] : NES_BATCH_ROUTE;
+	std::string Response;
+	if (!_Sim.Client_->MakeJSONQuery(Route, Batch.dump(), &Response)) {
+		_Logger->Log("Error fetching data of simulation " + std::to_string(_Sim.SimID_), 7);
+		return false;
+	}
+
+	// Only the per-element status goes into a DOM, the bulk arrays are decoded straight from the text
+	nlohmann::json Responses = ParseResponseSkeleton(Response);
+	if (Responses.is_discarded() || !Responses.is_array()) {
+		_Logger->Log("Malformed NES response fetching data of simulation " + std::to_string(_Sim.SimID_), 7);
+		return false;
+	}
+	std::vector<bool> Decoded(BatchFields.size(), false);
+	for (size_t Position = 0; Position < Responses.size(); Position++) {
+		const nlohmann::json& Element = Responses[Position];
+		if (!Element.is_object() || !Element.contains("ReqID") || !Element["ReqID"].is_number_unsigned()) {
+			continue;
+		}
+		size_t ReqID = Element["ReqID"].get<size_t>();
+		if (ReqID >= BatchFields.size() || Decoded[ReqID]) {
+			continue;
+		}
+		if (Element.value("StatusCode", -1) != 0) {
+			_Logger->Log("NES returned StatusCode " + std::to_string(Element.value("StatusCode", -1)) + " for " + FieldRequests[__builtin_ctz(BatchFields[ReqID])] + " of simulation " + std::to_string(_Sim.SimID_), 7);
+			return false;
+		}
+		if (!DecodeResponse(_Logger, BatchFields[ReqID], Response, Position, Element, _Dataset)) {
+			return false;
+		}
+		Decoded[ReqID] = true;
+	}
+
+	for (size_t i = 0; i < Decoded.size(); i++) {
+		if (!Decoded[i]) {
+			_Logger->Log(std::string("No NES response to ") + FieldRequests[__builtin_ctz(BatchFields[i])] + " of simulation " + std::to_string(_Sim.SimID_), 7);
+			return false;
+		}
+	}
+	_Dataset.Fields_ = _Fields;
+	return true;
+}
+
+
+bool GetNESSaveFingerprints(BG::Common::Logger::LoggingSystem* _Logger, SafeClient & _Client, const std::vector<std::string> & _SaveNames, std::vector<std::string> & _Fingerprints) {
+
+	std::vector<JSONQuery> Queries(_SaveNames.size());
+	for (size_t i = 0; i < _SaveNames.size(); i++) {
+		nlohmann::json Request = nlohmann::json::array();
+		Request.push_back({{"ReqID", 0}, {"Simulation/GetSaveFingerprint", {{"SavedSimName", _SaveNames[i]}}}});
+		Queries[i].Route_ = "Simulation/GetSaveFingerprint";
+		Queries[i].Query_ = Request.dump();
+	}
+	std::vector<QueryResult> Results;
+	_Client.MakeJSONQueries(Queries, Results);
+
+	_Fingerprints.assign(_SaveNames.size(), std::string());
+	bool AllFound = true;
+	for (size_t i = 0; i < _SaveNames.size(); i++) {
+		if (!Results[i].Success_) {
+			_Logger->Log("Error requesting the fingerprint of '" + _SaveNames[i] + "'", 6);
+			AllFound = false;
+			continue;
+		}
+
+		nlohmann::json Responses = nlohmann::json::parse(Results[i].Response_, nullptr, false);
+		if (Responses.is_discarded() || !Responses.is_array() || Responses.empty() || !Responses[0].is_object()
+			|| Responses[0].value("StatusCode", -1) != 0 || !Responses[0].contains("Fingerprint")) {
+			_Logger->Log("NES gave no fingerprint for '" + _SaveNames[i] + "'", 6);
+			AllFound = false;
+			continue;
+		}
+
+		// Opaque to us, numbers and strings are both fine
+		const nlohmann::json& Fingerprint = Responses[0]["Fingerprint"];
+		_Fingerprints[i] = Fingerprint.is_string() ? Fingerprint.get<std::string>() : Fingerprint.dump();
+		AllFound &= !_Fingerprints[i].empty();
+	}
+	return AllFound;
+}
+
+} // BG
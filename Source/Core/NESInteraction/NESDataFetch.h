@@ -0,0 +1,86 @@
+//===========================================================//
+// This file is part of the BrainGenix-EVM Validation System //
+//===========================================================//
+
+/*
+    Description: This file provides batched fetching of a simulation's validation data from NES.
+    Additional Notes: None
+    Date Created: 2024-06-24
+*/
+
+#pragma once
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <string>
+#include <vector>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <NESInteraction/NESRouter.h>
+#include <Util/BulkArray.h>
+
+#include <BG/Common/Logger/Logger.h>
+
+
+namespace BG {
+
+#define NES_BATCH_ROUTE "NES" /**NES route that accepts a batch of different requests*/
+
+/**
+ * Parts of a simulation's data that can be fetched, combine them with |.
+ * Each is one request of the batch, the comments give the request and the response fields decoded.
+ */
+enum NESDataField : unsigned {
+    NES_DATA_SOMA_POSITIONS = 1u << 0,  // Simulation/GetSomaPositions -> "SomaPositions"
+    NES_DATA_NEURON_TYPES   = 1u << 1,  // Simulation/GetNeuronTypes -> "NeuronTypes"
+    NES_DATA_CONNECTIVITY   = 1u << 2,  // Simulation/GetConnectivity -> "ConnectionPairs"
+    NES_DATA_COMPARTMENTS   = 1u << 3,  // Simulation/GetCompartments -> "CompartmentPositions", "CompartmentNeurons"
+    NES_DATA_RECORDINGS     = 1u << 4   // Simulation/GetRecording -> "RecordingTimes_ms", "Recording"
+};
+
+/**
+ * The fetched data of one simulation, arrays of fields that were not requested stay empty.
+ * Arrays may be read straight from shared memory, see Util::BulkArray.
+ */
+struct SimDataset {
+    unsigned Fields_ = 0; /**NESDataField bits that were fetched*/
+
+    EVM::Util::BulkArray<float> SomaPositions_;         /**x0,y0,z0,x1,... per neuron (um)*/
+    EVM::Util::BulkArray<int> NeuronTypes_;             /**Type of each neuron*/
+    EVM::Util::BulkArray<int> ConnectionPairs_;         /**pre0,post0,pre1,post1,... per connection*/
+    EVM::Util::BulkArray<float> CompartmentPositions_;  /**x0,y0,z0,x1,... per compartment (um)*/
+    EVM::Util::BulkArray<int> CompartmentNeurons_;      /**Neuron each compartment belongs to*/
+    EVM::Util::BulkArray<float> RecordingTimes_ms_;     /**Time of each recorded sample*/
+    EVM::Util::BulkArray<float> Recording_;             /**Membrane potential per sample and neuron, sample-major (mV)*/
+};
+
+/**
+ * Fetches the requested fields of a loaded simulation in a single round trip.
+ * 
+ * One batched request [{"ReqID": 0, "Simulation/Get...": {"SimID": ...}}, ...] is sent to the backend
+ * that owns the simulation, and the combined response is parsed once and decoded into typed arrays.
+ * A single field is requested on its own route, so identical concurrent fetches can be coalesced.
+ * 
+ * @param _Logger Pointer to the logging system instance.
+ * @param _Sim Loaded system.
+ * @param _Fields NESDataField bits to fetch.
+ * @param _Dataset Receives the arrays, Fields_ is set to _Fields on success.
+ * @return True if every requested field was fetched.
+ */
+bool FetchSimDataset(BG::Common::Logger::LoggingSystem* _Logger, const NESSim & _Sim, unsigned _Fields, SimDataset & _Dataset);
+
+/**
+ * Asks NES for the fingerprints of saved simulations ("Simulation/GetSaveFingerprint"),
+ * which change whenever the save does. The saves do not have to be loaded.
+ * All requests are pipelined on one connection, so this takes about one round trip.
+ * 
+ * @param _Logger Pointer to the logging system instance.
+ * @param _Client Client of the backend to ask.
+ * @param _SaveNames Save names of the systems.
+ * @param _Fingerprints Receives one fingerprint (opaque text) per save, in the same order, empty where NES gave none.
+ * @return True if NES gave every one, false e.g. if the backend does not support the request.
+ */
+bool GetNESSaveFingerprints(BG::Common::Logger::LoggingSystem* _Logger, SafeClient & _Client, const std::vector<std::string> & _SaveNames, std::vector<std::string> & _Fingerprints);
+
+} // BG
@@ -0,0 +1,131 @@
+//=================================//
+// This file is part of BrainGenix //
+//=================================//
+
+
+// Standard Libraries (BG convention: use <> instead of "")
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <NESInteraction/NESRouter.h>
+#include <NESInteraction/NESDataCache.h>
+#include <NESInteraction/NESSimHandle.h>
+
+
+namespace BG {
+
+
+NESRouter::NESRouter(BG::Common::Logger::LoggingSystem* _Logger, const EVM::Config::Config& _Config, SafeClient* _DefaultClient) {
+
+	Logger_ = _Logger;
+
+	for (const std::string& Entry : _Config.NESBackends) {
+		size_t Separator = Entry.rfind(':');
+		if (Separator == std::string::npos || Separator == 0) {
+			_Logger->Log("Ignoring NES Backend '" + Entry + "', Expected 'host:port'", 7);
+			continue;
+		}
+		int Port;
+		try {
+			Port = std::stoi(Entry.substr(Separator + 1));
+		} catch (std::exception&) {
+			_Logger->Log("Ignoring NES Backend '" + Entry + "', Invalid Port", 7);
+			continue;
+		}
+
+		std::unique_ptr<Backend> NewBackend = std::make_unique<Backend>();
+		NewBackend->OwnedClient_ = std::make_unique<SafeClient>(_Logger, _Config.ConnectionPoolSize);
+		NewBackend->OwnedClient_->SetSharedMemoryTransport(_Config.UseSharedMemoryTransport);
+		NewBackend->OwnedClient_->SetSingleFlight(_Config.SingleFlight);
+		NewBackend->OwnedClient_->SetHedging(_Config.Hedging);
+		NewBackend->OwnedClient_->SetHealthCheckTiming(_Config.IdleProbeInterval_ms, _Config.ReconnectBackoffMin_ms, _Config.ReconnectBackoffMax_ms);
+		NewBackend->OwnedClient_->SetTimeout(_Config.NESTimeout_ms);
+		NewBackend->OwnedClient_->SetHostPort(Entry.substr(0, Separator), Port);
+		NewBackend->Client_ = NewBackend->OwnedClient_.get();
+		NewBackend->Name_ = Entry;
+		Backends_.push_back(std::move(NewBackend));
+		_Logger->Log("Added NES Backend '" + Entry + "'", 4);
+	}
+
+	if (Backends_.empty()) {
+		std::unique_ptr<Backend> Default = std::make_unique<Backend>();
+		Default->Client_ = _DefaultClient;
+		Backends_.push_back(std::move(Default));
+	}
+
+	if (!_Config.SnapshotCacheDir.empty()) {
+		DataCache_ = std::make_unique<NESDataCache>(_Logger, _Config.SnapshotCacheDir);
+	}
+	SimManager_ = std::make_unique<NESSimManager>(_Logger, *this);
+}
+
+NESRouter::~NESRouter() {
+}
+
+NESRouter::Backend* NESRouter::PickBackend() {
+
+	// Least loaded healthy backend, if none is healthy the least loaded one (its calls will fail and be reported)
+	Backend* Best = nullptr;
+	bool BestHealthy = false;
+	for (std::unique_ptr<Backend>& Candidate : Backends_) {
+		bool Healthy = Candidate->Client_->IsHealthy();
+		if (Best == nullptr || (Healthy && !BestHealthy) || (Healthy == BestHealthy && Candidate->Placed_ < Best->Placed_)) {
+			Best = Candidate.get();
+			BestHealthy = Healthy;
+		}
+	}
+	return Best;
+}
+
+SafeClient* NESRouter::Place() {
+	std::lock_guard<std::mutex> Lock(PlaceMutex_);
+	Backend* Best = PickBackend();
+	Best->Placed_++;
+	return Best->Client_;
+}
+
+SafeClient* NESRouter::Pick() {
+	std::lock_guard<std::mutex> Lock(PlaceMutex_);
+	return PickBackend()->Client_;
+}
+
+void NESRouter::Unplace(SafeClient* _Client) {
+	std::lock_guard<std::mutex> Lock(PlaceMutex_);
+	for (std::unique_ptr<Backend>& Candidate : Backends_) {
+		if (Candidate->Client_ == _Client && Candidate->Placed_ > 0) {
+			Candidate->Placed_--;
+			return;
+		}
+	}
+}
+
+NESCompletionSignal* NESRouter::GetCompletionSignal() {
+	return &Completion_;
+}
+
+void NESRouter::NotifyCompleted(const std::string& _Backend) {
+	const SafeClient* From = nullptr;
+	for (const std::unique_ptr<Backend>& Candidate : Backends_) {
+		if (Candidate->Name_ == _Backend || Backends_.size() == 1) {
+			From = Candidate->Client_;
+			break;
+		}
+	}
+	Completion_.Notify(From);
+}
+
+NESDataCache* NESRouter::GetDataCache() {
+	return DataCache_.get();
+}
+
+NESSimManager* NESRouter::GetSimManager() {
+	return SimManager_.get();
+}
+
+size_t NESRouter::GetNumBackends() const {
+	return Backends_.size();
+}
+
+
+} // BG
@@ -0,0 +1,169 @@
+//===========================================================//
+// This file is part of the BrainGenix-EVM Validation System //
+//===========================================================//
+
+/*
+    Description: This file provides placement of simulations across several NES backends.
+    Additional Notes: None
+    Date Created: 2024-06-10
+*/
+
+#pragma once
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <RPC/SafeClient.h>
+#include <NESInteraction/NESCompletion.h>
+
+#include <Config/Config.h>
+
+#include <BG/Common/Logger/Logger.h>
+
+
+namespace BG {
+
+class NESDataCache;
+class NESSimManager;
+
+
+/**
+ * A simulation loaded in NES. SimIDs are only unique per NES process, so the
+ * simulation is identified by the backend that owns it together with its SimID,
+ * and every call concerning it must go through Client_.
+ */
+struct NESSim {
+    SafeClient* Client_ = nullptr; /**Client of the NES backend that owns the simulation*/
+    int SimID_ = -1; /**Simulation ID on that backend*/
+};
+
+
+/**
+ * Holds the set of NES backends a validation may use and decides where each
+ * simulation is loaded. Placement picks the healthy backend with the fewest
+ * simulations currently placed on it, so the two simulations of a validation
+ * end up on different backends whenever there are at least two.
+ * 
+ * Without configured backends (NES_Backends), everything goes to the default
+ * client, which is the connection set up by the API service's callback.
+ */
+class NESRouter {
+
+private:
+
+    struct Backend {
+        std::unique_ptr<SafeClient> OwnedClient_; /**Client made for a configured backend, nullptr for the default client*/
+        SafeClient* Client_ = nullptr; /**Client used for this backend*/
+        std::string Name_; /**"host:port" as given in NES_Backends, empty for the default client*/
+        int Placed_ = 0; /**Simulations currently placed here, protected by PlaceMutex_*/
+    };
+
+    BG::Common::Logger::LoggingSystem* Logger_ = nullptr; /**Pointer to the instance of the logging system*/
+    std::vector<std::unique_ptr<Backend>> Backends_; /**Fixed after construction*/
+    std::mutex PlaceMutex_; /**Protects the placement counters*/
+    NESCompletionSignal Completion_; /**Woken by completion callbacks of any backend*/
+    std::unique_ptr<NESDataCache> DataCache_; /**On-disk cache of fetched simulation data, nullptr if not configured*/
+    std::unique_ptr<NESSimManager> SimManager_; /**Shares loaded simulations between validations*/
+
+    /**
+     * @brief Returns the backend a new simulation should go to, PlaceMutex_ must be held.
+     */
+    Backend* PickBackend();
+
+public:
+
+    /**
+     * @brief Construct a new NESRouter object
+     * 
+     * @param _Logger Pointer to the logging system instance.
+     * @param _Config Provides NES_Backends ("host:port" entries) and the client settings used for each.
+     * @param _DefaultClient Used if no backends are configured.
+     */
+    NESRouter(BG::Common::Logger::LoggingSystem* _Logger, const EVM::Config::Config& _Config, SafeClient* _DefaultClient);
+
+    /**
+     * @brief Destroy the NESRouter object
+     */
+    ~NESRouter();
+
+    /**
+     * @brief Picks the backend for a new simulation and counts it as placed there.
+     * Every call must be paired with Unplace(), see NESPlacement.
+     * 
+     * @return SafeClient* Client of the chosen backend.
+     */
+    SafeClient* Place();
+
+    /**
+     * @brief Releases a placement made with Place().
+     */
+    void Unplace(SafeClient* _Client);
+
+    /**
+     * @brief Returns the client Place() would choose, without placing anything.
+     * For queries that are not about a loaded simulation, e.g. GetNESSaveFingerprints().
+     */
+    SafeClient* Pick();
+
+    /**
+     * @brief Returns the number of backends (1 if only the default client is used).
+     */
+    size_t GetNumBackends() const;
+
+    /**
+     * @brief Returns the signal that NES completion callbacks ("NESCompleted") wake.
+     */
+    NESCompletionSignal* GetCompletionSignal();
+
+    /**
+     * @brief Wakes the loads waiting for NES and records which backend called back.
+     * 
+     * @param _Backend "host:port" the completion came from, as listed in NES_Backends. May be empty
+     * if NES does not say, the backend is then only known if there is just one.
+     */
+    void NotifyCompleted(const std::string& _Backend);
+
+    /**
+     * @brief Returns the on-disk cache of fetched simulation data (NES_SnapshotCacheDir), nullptr if none is configured.
+     */
+    NESDataCache* GetDataCache();
+
+    /**
+     * @brief Returns the manager through which simulations are loaded and shared, see SimHandle.
+     */
+    NESSimManager* GetSimManager();
+
+};
+
+
+/**
+ * Scoped placement: picks a backend on construction and releases it on destruction.
+ */
+class NESPlacement {
+
+private:
+
+    NESRouter& Router_;
+    SafeClient* Client_ = nullptr;
+
+public:
+
+    NESPlacement(NESRouter& _Router) : Router_(_Router), Client_(_Router.Place()) {}
+    ~NESPlacement() { Router_.Unplace(Client_); }
+
+    NESPlacement(const NESPlacement&) = delete;
+    NESPlacement& operator=(const NESPlacement&) = delete;
+
+    SafeClient* Client() const { return Client_; }
+
+};
+
+
+} // BG
@@ -0,0 +1,124 @@
+//=================================//
+// This file is part of BrainGenix //
+//=================================//
+
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <chrono>
+#include <exception>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <NESInteraction/NESSimHandle.h>
+#include <NESInteraction/NESSimLoad.h>
+
+
+namespace BG {
+
+SimHandle::SimHandle(SimHandle&& _Other) noexcept {
+	*this = std::move(_Other);
+}
+
+SimHandle& SimHandle::operator=(SimHandle&& _Other) noexcept {
+	if (this != &_Other) {
+		Release();
+		Manager_ = _Other.Manager_;
+		Sim_ = std::move(_Other.Sim_);
+		_Other.Manager_ = nullptr;
+	}
+	return *this;
+}
+
+void SimHandle::Release() {
+	if (Sim_ != nullptr) {
+		Manager_->Release(Sim_);
+		Sim_.reset();
+	}
+	Manager_ = nullptr;
+}
+
+
+NESSimManager::NESSimManager(BG::Common::Logger::LoggingSystem* _Logger, NESRouter& _Router) : Router_(_Router) {
+	Logger_ = _Logger;
+}
+
+SimHandle NESSimManager::Acquire(const std::string& _SaveName, unsigned long _Timeout_ms) {
+
+	// Join a load of the same save, or become the one doing it
+	std::shared_ptr<ManagedSim> Sim;
+	std::promise<bool> LoadPromise;
+	bool Loader = false;
+	{
+		std::lock_guard<std::mutex> Lock(Mutex_);
+		auto Iterator = Sims_.find(_SaveName);
+		if (Iterator != Sims_.end()) {
+			Sim = Iterator->second;
+		} else {
+			Sim = std::make_shared<ManagedSim>();
+			Sim->SaveName_ = _SaveName;
+			Sim->Loaded_ = LoadPromise.get_future().share();
+			Sims_[_SaveName] = Sim;
+			Loader = true;
+		}
+		Sim->Users_++;
+	}
+
+	if (Loader) {
+		// Whatever happens, the joined users must get an answer and a failed entry must not stay behind
+		bool Loaded = false;
+		try {
+			Sim->Sim_.Client_ = Router_.Place();
+			Loaded = AwaitNESSimLoad(Logger_, *Sim->Sim_.Client_, _SaveName, Sim->Sim_.SimID_, _Timeout_ms, Router_.GetCompletionSignal());
+		} catch (std::exception& e) {
+			Logger_->Log("Error While Loading '" + _SaveName + "' In NES: " + std::string(e.what()), 7);
+			Loaded = false;
+		}
+		if (!Loaded) {
+			// Not kept, so the next user tries again
+			std::lock_guard<std::mutex> Lock(Mutex_);
+			auto Iterator = Sims_.find(_SaveName);
+			if (Iterator != Sims_.end() && Iterator->second == Sim) {
+				Sims_.erase(Iterator);
+			}
+		}
+		LoadPromise.set_value(Loaded);
+	} else {
+		Logger_->Log("Sharing The NES Load Of '" + _SaveName + "'", 1);
+	}
+
+	// The loader's own wait is already bounded by the timeout, the others may have joined late
+	if (Sim->Loaded_.wait_for(std::chrono::milliseconds(_Timeout_ms)) != std::future_status::ready || !Sim->Loaded_.get()) {
+		Release(Sim);
+		return SimHandle();
+	}
+	return SimHandle(this, std::move(Sim));
+}
+
+void NESSimManager::Release(const std::shared_ptr<ManagedSim>& _Sim) {
+	{
+		std::lock_guard<std::mutex> Lock(Mutex_);
+		if (--_Sim->Users_ > 0) {
+			return;
+		}
+		auto Iterator = Sims_.find(_Sim->SaveName_);
+		if (Iterator != Sims_.end() && Iterator->second == _Sim) {
+			Sims_.erase(Iterator);
+		}
+	}
+
+	// Last user, so the load has finished (the loader holds a use until then) and nobody else can reach it
+	if (_Sim->Loaded_.get() && _Sim->Sim_.SimID_ >= 0) {
+		UnloadNESSim(Logger_, *_Sim->Sim_.Client_, _Sim->Sim_.SimID_);
+	}
+	if (_Sim->Sim_.Client_ != nullptr) {
+		Router_.Unplace(_Sim->Sim_.Client_);
+	}
+}
+
+size_t NESSimManager::GetNumLoaded() {
+	std::lock_guard<std::mutex> Lock(Mutex_);
+	return Sims_.size();
+}
+
+} // BG
@@ -0,0 +1,135 @@
+//===========================================================//
+// This file is part of the BrainGenix-EVM Validation System //
+//===========================================================//
+
+/*
+    Description: This file provides shared, reference-counted handles to simulations loaded in NES.
+    Additional Notes: None
+    Date Created: 2024-06-28
+*/
+
+#pragma once
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <NESInteraction/NESRouter.h>
+
+#include <BG/Common/Logger/Logger.h>
+
+
+namespace BG {
+
+class NESSimManager;
+
+/**
+ * A save loaded in NES on behalf of all its current users.
+ */
+struct ManagedSim {
+    std::string SaveName_; /**Save name the simulation was loaded from*/
+    NESSim Sim_; /**Backend and SimID, written by the loading user before Loaded_ becomes ready*/
+    int Users_ = 0; /**Handles (and waiting acquirers) using it, protected by the manager's mutex*/
+    std::shared_future<bool> Loaded_; /**Becomes ready with the outcome of the load*/
+};
+
+
+/**
+ * Move-only handle to a loaded simulation, releases its use when destroyed.
+ * The simulation is unloaded from NES once its last handle is released.
+ */
+class SimHandle {
+
+private:
+
+    NESSimManager* Manager_ = nullptr; /**Manager the simulation is released to, must outlive the handle*/
+    std::shared_ptr<ManagedSim> Sim_; /**nullptr if the handle holds nothing*/
+
+public:
+
+    SimHandle() = default;
+    SimHandle(NESSimManager* _Manager, std::shared_ptr<ManagedSim> _Sim) : Manager_(_Manager), Sim_(std::move(_Sim)) {}
+    ~SimHandle() { Release(); }
+
+    SimHandle(const SimHandle&) = delete;
+    SimHandle& operator=(const SimHandle&) = delete;
+    SimHandle(SimHandle&& _Other) noexcept;
+    SimHandle& operator=(SimHandle&& _Other) noexcept;
+
+    /**
+     * @brief Returns true if the handle holds a loaded simulation.
+     */
+    bool IsValid() const { return Sim_ != nullptr; }
+
+    /**
+     * @brief Returns the loaded simulation, an unloaded NESSim (no client, SimID -1) if the handle holds nothing.
+     */
+    NESSim Sim() const { return Sim_ != nullptr ? Sim_->Sim_ : NESSim(); }
+
+    /**
+     * @brief Gives up the use of the simulation early, the handle holds nothing afterwards.
+     */
+    void Release();
+
+};
+
+
+/**
+ * Loads saves into NES on demand and shares them: concurrent users of the same
+ * save name get the same loaded SimID instead of each loading their own copy,
+ * and the simulation is unloaded (and its placement freed) as soon as the last
+ * user releases it. This bounds the memory used in NES and skips redundant loads.
+ * 
+ * A failed load is not kept, the next Acquire() of that save tries again.
+ */
+class NESSimManager {
+
+private:
+
+    BG::Common::Logger::LoggingSystem* Logger_ = nullptr; /**Pointer to the instance of the logging system*/
+    NESRouter& Router_; /**Places the simulations on backends*/
+
+    std::mutex Mutex_; /**Protects Sims_ and the user counts*/
+    std::unordered_map<std::string, std::shared_ptr<ManagedSim>> Sims_; /**Loaded or loading simulations by save name*/
+
+    friend class SimHandle;
+
+    /**
+     * @brief Drops one use of a simulation, unloading it if it was the last.
+     */
+    void Release(const std::shared_ptr<ManagedSim>& _Sim);
+
+public:
+
+    /**
+     * @brief Construct a new NESSimManager object
+     * 
+     * @param _Logger Pointer to the logging system instance.
+     * @param _Router Router the simulations are placed with, must outlive the manager.
+     */
+    NESSimManager(BG::Common::Logger::LoggingSystem* _Logger, NESRouter& _Router);
+
+    /**
+     * @brief Returns a handle to the save loaded in NES, loading it first unless another user already did (or is doing so).
+     * 
+     * @param _SaveName Save name of the system.
+     * @param _Timeout_ms Longest time to wait for the load.
+     * @return SimHandle Invalid if the load failed or took too long.
+     */
+    SimHandle Acquire(const std::string& _SaveName, unsigned long _Timeout_ms);
+
+    /**
+     * @brief Returns the number of simulations currently loaded (or loading).
+     */
+    size_t GetNumLoaded();
+
+};
+
+
+} // BG
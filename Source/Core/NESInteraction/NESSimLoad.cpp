@@ -4,6 +4,7 @@
 
 
 // Standard Libraries (BG convention: use <> instead of "")
+#include <algorithm>
 #include <thread>
 #include <chrono>
 
@@ -17,19 +18,23 @@
 
 namespace BG {
 
-bool GetNESStatus(BG::Common::Logger::LoggingSystem* _Logger, SafeClient & _Client, BGStatusCode & _StatusCode) {
+bool GetNESStatus(BG::Common::Logger::LoggingSystem* _Logger, SafeClient & _Client, BGStatusCode & _StatusCode, int _Deadline_ms) {
 	std::string CheckStatusRequest("");
 	std::string Response;
-	bool Status = _Client.MakeJSONQuery("", CheckStatusRequest, &Response);
+	bool Status = _Client.MakeJSONQuery("", CheckStatusRequest, &Response, false, _Deadline_ms);
 
 	if (!Status) {
 		_Logger->Log("Status request to NES failed", 7);
     	return false;
 	}
 
-	nlohmann::json ResponseJSON(Response);
-	auto Iterator = Response.find("StatusCode");
-	if (Iterator == Response.end()) {
+	nlohmann::json ResponseJSON = nlohmann::json::parse(Response, nullptr, false);
+	if (ResponseJSON.is_discarded() || !ResponseJSON.is_object()) {
+		_Logger->Log("Malformed loading status response", 7);
+		return false;
+	}
+	auto Iterator = ResponseJSON.find("StatusCode");
+	if (Iterator == ResponseJSON.end()) {
 		_Logger->Log("No 'StatusCode' in loading status response", 7);
 		return false;
 	}
@@ -43,11 +48,23 @@ bool GetNESStatus(BG::Common::Logger::LoggingSystem* _Logger, SafeClient & _Clie
 	return true;
 }
 
-bool AwaitNESOutcome(BG::Common::Logger::LoggingSystem* _Logger, SafeClient& _Client, unsigned long _Timeout_ms) {
-	unsigned long Timeout_ms = _Timeout_ms;
+bool AwaitNESOutcome(BG::Common::Logger::LoggingSystem* _Logger, SafeClient& _Client, unsigned long _Timeout_ms, NESCompletionSignal* _Completion) {
+	std::chrono::steady_clock::time_point Deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(_Timeout_ms);
+
+	// Short processes are noticed quickly, long ones cost few status queries.
+	// Once this backend is known to call back, polling is only a safety net.
+	bool HasCallbacks = (_Completion != nullptr) && _Completion->HasCallbacks(&_Client);
+	std::chrono::milliseconds Interval(HasCallbacks ? NES_STATUS_POLL_MAX_WITH_CALLBACK_MS : NES_STATUS_POLL_MIN_MS);
+	std::chrono::milliseconds MaxInterval(HasCallbacks ? NES_STATUS_POLL_MAX_WITH_CALLBACK_MS : NES_STATUS_POLL_MAX_MS);
 	while (true) {
+
+		// Taken before the query, so a callback arriving while it runs still wakes the wait below
+		std::uint64_t Generation = (_Completion != nullptr) ? _Completion->GetGeneration() : 0;
+
+		std::chrono::steady_clock::time_point Now = std::chrono::steady_clock::now();
+		int Remaining_ms = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(Deadline - Now).count());
 		BGStatusCode StatusCode;
-		if (!GetNESStatus(_Logger, _Client, StatusCode)) {
+		if (!GetNESStatus(_Logger, _Client, StatusCode, std::max(Remaining_ms, 1))) {
 			_Logger->Log("NES Status request failed while waiting for process to complete", 7);
 			return false;
 		}
@@ -61,12 +78,20 @@ bool AwaitNESOutcome(BG::Common::Logger::LoggingSystem* _Logger, SafeClient& _Cl
 	        return false;
     	}
 
-		Timeout_ms--;
-		if (Timeout_ms==0) {
+		Now = std::chrono::steady_clock::now();
+		if (Now >= Deadline) {
 			_Logger->Log("Awaiting NES Process request timed out after "+std::to_string(_Timeout_ms)+" ms", 7);
         	return false;
 		}
-		std::this_thread::sleep_for (std::chrono::milliseconds(1));
+
+		std::chrono::steady_clock::time_point WakeAt = std::min(Now + Interval, Deadline);
+		Interval = std::min(Interval * 2, MaxInterval);
+
+		if (_Completion != nullptr) {
+			_Completion->WaitForNotification(Generation, WakeAt);
+		} else {
+			std::this_thread::sleep_until(WakeAt);
+		}
 	}
 }
 
@@ -78,15 +103,19 @@ bool AwaitNESOutcome(BG::Common::Logger::LoggingSystem* _Logger, SafeClient& _Cl
  * @param _SimSaveName Name of the previously saved simulation.
  * @param _SimID Reference through which to return the simulation ID.
  * @param _Timeout_ms Timeout that ensures this function cannot become stuck forever (e.g. due to broken connection),
+ * @param _Completion Optional, see AwaitNESOutcome().
  * @return True if loading was successful.
  */
-bool AwaitNESSimLoad(BG::Common::Logger::LoggingSystem* _Logger, SafeClient & _Client, const std::string & _SimSaveName, int & _SimID, unsigned long _Timeout_ms) {
+bool AwaitNESSimLoad(BG::Common::Logger::LoggingSystem* _Logger, SafeClient & _Client, const std::string & _SimSaveName, int & _SimID, unsigned long _Timeout_ms, NESCompletionSignal* _Completion) {
 
 	_Logger->Log("Await NES Sim Load '" + _SimSaveName + "'", 1);
 
 	// Start a simulation load request.
 
-	std::string SimLoadRequest("[{\"ReqID\":0,\"Simulation/Load\": { \"SavedSimName\": "+_SimSaveName+" } }]");
+	// The name is escaped by the serializer, it may contain quotes or backslashes
+	nlohmann::json LoadRequest = nlohmann::json::array();
+	LoadRequest.push_back({{"ReqID", 0}, {"Simulation/Load", {{"SavedSimName", _SimSaveName}}}});
+	std::string SimLoadRequest = LoadRequest.dump();
 	std::string Response;
 	bool Status = _Client.MakeJSONQuery("Simulation/Load", SimLoadRequest, &Response);
 
@@ -97,7 +126,7 @@ bool AwaitNESSimLoad(BG::Common::Logger::LoggingSystem* _Logger, SafeClient & _C
 
 	// Wait for status to indicate that loading completed or failed.
 
-	if (!AwaitNESOutcome(_Client, _Timeout_ms)) {
+	if (!AwaitNESOutcome(_Logger, _Client, _Timeout_ms, _Completion)) {
 		_Logger->Log("Awaiting completion of NES load request failed", 7);
 		return false;
 	}
@@ -106,8 +135,35 @@ bool AwaitNESSimLoad(BG::Common::Logger::LoggingSystem* _Logger, SafeClient & _C
 
 	// *** Right... this needs some special support, because loading right now does not
 	//     work as a process that can be awaited...
+	//     Servers that already report the ID in the load response (e.g. the NES emulator) are supported.
+	nlohmann::json ResponseJSON = nlohmann::json::parse(Response, nullptr, false);
+	if (ResponseJSON.is_array() && !ResponseJSON.empty() && ResponseJSON[0].is_object()) {
+		auto Iterator = ResponseJSON[0].find("SimulationID");
+		if (Iterator != ResponseJSON[0].end() && Iterator.value().is_number_integer()) {
+			_SimID = Iterator.value().template get<int>();
+		}
+	}
 
 	return true;
 }
 
+bool UnloadNESSim(BG::Common::Logger::LoggingSystem* _Logger, SafeClient & _Client, int _SimID) {
+
+	nlohmann::json UnloadRequest = nlohmann::json::array();
+	UnloadRequest.push_back({{"ReqID", 0}, {"Simulation/Unload", {{"SimID", _SimID}}}});
+	std::string Response;
+	if (!_Client.MakeJSONQuery("Simulation/Unload", UnloadRequest.dump(), &Response)) {
+		_Logger->Log("Error During Simulation Unload Request To NES", 7);
+		return false;
+	}
+
+	nlohmann::json ResponseJSON = nlohmann::json::parse(Response, nullptr, false);
+	if (!ResponseJSON.is_array() || ResponseJSON.empty() || !ResponseJSON[0].is_object() || ResponseJSON[0].value("StatusCode", -1) != BGStatusSuccess) {
+		_Logger->Log("NES Did Not Unload Simulation " + std::to_string(_SimID), 6);
+		return false;
+	}
+	_Logger->Log("Unloaded NES Simulation " + std::to_string(_SimID), 1);
+	return true;
+}
+
 } // BG
@@ -18,12 +18,17 @@
 
 // Internal Libraries (BG convention: use <> instead of "")
 #include <RPC/SafeClient.h>
+#include <NESInteraction/NESCompletion.h>
 
 #include <BG/Common/Logger/Logger.h>
 
 
 namespace BG {
 
+#define NES_STATUS_POLL_MIN_MS 1 /**First wait between status queries, doubled after each busy reply*/
+#define NES_STATUS_POLL_MAX_MS 1000 /**Longest wait between status queries*/
+#define NES_STATUS_POLL_MAX_WITH_CALLBACK_MS 5000 /**Wait between status queries once NES is known to send completion callbacks*/
+
 
 enum BGStatusCode {
     BGStatusSuccess = 0,
@@ -37,9 +42,21 @@ enum BGStatusCode {
 
 
 
-bool GetNESStatus(BG::Common::Logger::LoggingSystem* _Logger, SafeClient& _Client, BGStatusCode& _StatusCode);
+bool GetNESStatus(BG::Common::Logger::LoggingSystem* _Logger, SafeClient& _Client, BGStatusCode& _StatusCode, int _Deadline_ms = -1);
 
-bool AwaitNESOutcome(BG::Common::Logger::LoggingSystem* _Logger, SafeClient& _Client, unsigned long _Timeout_ms = 100000);
+/**
+ * Wait until the running NES process (e.g. a load) completes or fails.
+ * 
+ * The status is queried with a backoff that doubles from NES_STATUS_POLL_MIN_MS up to
+ * NES_STATUS_POLL_MAX_MS. If a completion signal is given, a "NESCompleted" callback
+ * from NES ends the current wait at once, and backends known to call back are polled rarely.
+ * 
+ * @param _Client Reference to client connection with NES.
+ * @param _Timeout_ms Wall-clock time after which waiting is given up.
+ * @param _Completion Optional, signalled by NES completion callbacks.
+ * @return True if the process completed successfully.
+ */
+bool AwaitNESOutcome(BG::Common::Logger::LoggingSystem* _Logger, SafeClient& _Client, unsigned long _Timeout_ms = 100000, NESCompletionSignal* _Completion = nullptr);
 
 /**
  * Ask NES to load a previously saved simulation and wait for loading
@@ -49,8 +66,18 @@ bool AwaitNESOutcome(BG::Common::Logger::LoggingSystem* _Logger, SafeClient& _Cl
  * @param _SimSaveName Name of the previously saved simulation.
  * @param _SimID Reference through which to return the simulation ID.
  * @param _Timeout_ms Timeout that ensures this function cannot become stuck forever (e.g. due to broken connection),
+ * @param _Completion Optional, see AwaitNESOutcome().
  * @return True if loading was successful.
  */
-bool AwaitNESSimLoad(BG::Common::Logger::LoggingSystem* _Logger, SafeClient& _Client, const std::string& _SimSaveName, int& _SimID, unsigned long _Timeout_ms = 100000);
+bool AwaitNESSimLoad(BG::Common::Logger::LoggingSystem* _Logger, SafeClient& _Client, const std::string& _SimSaveName, int& _SimID, unsigned long _Timeout_ms = 100000, NESCompletionSignal* _Completion = nullptr);
+
+/**
+ * Ask NES to unload a simulation and free its memory, see NESSimManager.
+ * 
+ * @param _Client Reference to client connection with the NES backend that holds the simulation.
+ * @param _SimID ID of the simulation.
+ * @return True if NES unloaded it.
+ */
+bool UnloadNESSim(BG::Common::Logger::LoggingSystem* _Logger, SafeClient& _Client, int _SimID);
 
 } // BG
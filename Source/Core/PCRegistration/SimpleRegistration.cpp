@@ -4,41 +4,20 @@
 
 
 // Standard Libraries (BG convention: use <> instead of "")
-#include <thread>
+#include <vector>
 
 // Third-Party Libraries (BG convention: use <> instead of "")
 
 // Internal Libraries (BG convention: use <> instead of "")
 #include <PCRegistration/SimpleRegistration.h>
+#include <Util/BulkArray.h>
+
 
 namespace BG {
 
-/**
- * Uses centering and rotations to find the best registration of one network
- * onto the other and returns a cell ID map in accordance with the registration
- * that can be used for subsequent validation processes.
- * 
- * Note that the two simulations must be loaded before calling this function
- * with their numerical IDs.
- * 
- * @param _Client Reference to NES-connected client object.
- * @param _SimIDA Identifier of saved system A (typically a ground-truth system).
- * @param _SimIDB Identifier of saved system B (typically an emulation system).
- * @param _RegistrationMap Vector of cell indices specifying which neuron in B maps
- *        to the vector index neuron in A.
- * @return True if successfully registered.
- */
-bool SimpleRegistration(SafeClient & _Client, int _SimIDA, int _SimIDB, std::vector<int> & _RegistrationMap) {
-
-	Logger_->Log("Simple Registration of one simulation network onto another", 1);
-
-	// 1. Request the soma positions of SimIDA
-	std::string SimIDASomasRequest("[{\"ReqID\":0,\"Simulation/GetSomaPositions\": { \"SimID\": "+std::to_string(_SimIDA)+" } }]");
-	bool Status = _Client.MakeJSONQuery("Simulation/GetSomaPositions", SimIDASomasRequest, &Response);
-
-	// 2. Request the soma positions of SimIDB
-	std::string SimIDBSomasRequest("[{\"ReqID\":0,\"Simulation/GetSomaPositions\": { \"SimID\": "+std::to_string(_SimIDB)+" } }]");
-	bool Status = _Client.MakeJSONQuery("Simulation/GetSomaPositions", SimIDASomasRequest, &Response);
+bool SimpleRegistration(BG::Common::Logger::LoggingSystem* _Logger, const EVM::Util::BulkArray<float> & _SomaPositionsA, const EVM::Util::BulkArray<float> & _SomaPositionsB, std::vector<int> & _RegistrationMap) {
+
+	_Logger->Log("Simple Registration of one simulation network onto another", 1);
 
 	// 3. Center both networks.
 
@@ -46,6 +25,10 @@ bool SimpleRegistration(SafeClient & _Client, int _SimIDA, int _SimIDB, std::vec
 
 	// 5. Return registered correspondence ID map.
 
+	// Until the steps above exist there is no mapping, so no validation can succeed on it
+	_RegistrationMap.clear();
+	_Logger->Log("Simple Registration is not implemented yet, failing", 7);
+	return false;
 }
 
 }; // Close Namespace BG
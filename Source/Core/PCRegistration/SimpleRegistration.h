@@ -17,26 +17,31 @@
 
 
 // Internal Libraries (BG convention: use <> instead of "")
-#include <RPC/SafeClient.h>
+#include <NESInteraction/NESDataFetch.h>
+#include <Util/BulkArray.h>
+
+#include <BG/Common/Logger/Logger.h>
 
 
 namespace BG {
 
+#define SIMPLE_REGISTRATION_FIELDS NES_DATA_SOMA_POSITIONS /**Simulation data that SimpleRegistration() needs, see FetchSimDataset()*/
+
 /**
- * Uses centering and rotations to find the best registration of one network
- * onto the other and returns a cell ID map in accordance with the registration
- * that can be used for subsequent validation processes.
+ * Uses centering and rotations to find the best registration of network B
+ * onto network A from already fetched soma positions (see FetchSimDataset())
+ * and returns a cell ID map that can be used for subsequent validation processes.
  * 
- * Note that the two simulations must be loaded before calling this function
- * with their numerical IDs.
+ * Not implemented yet, so this always fails and no validation reports success.
  * 
- * @param _Client Reference to NES-connected client object.
- * @param _SimIDA Identifier of saved system A (typically a ground-truth system).
- * @param _SimIDB Identifier of saved system B (typically an emulation system).
+ * @param _Logger Pointer to the logging system instance.
+ * @param _SomaPositionsA Soma positions of system A (typically a ground-truth system).
+ * @param _SomaPositionsB Soma positions of system B (typically an emulation system).
  * @param _RegistrationMap Vector of cell indices specifying which neuron in B maps
  *        to the vector index neuron in A.
  * @return True if successfully registered.
  */
-bool SimpleRegistration(SafeClient & _Client, int _SimIDA, int _SimIDB, std::vector<int> & _RegistrationMap);
+bool SimpleRegistration(BG::Common::Logger::LoggingSystem* _Logger, const EVM::Util::BulkArray<float> & _SomaPositionsA, const EVM::Util::BulkArray<float> & _SomaPositionsB, std::vector<int> & _RegistrationMap);
+
 
 } // BG
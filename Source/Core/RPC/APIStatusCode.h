@@ -27,6 +27,7 @@ enum BGStatusCode {
     BGStatusUpstreamGatewayUnavailable = 3,
     BGStatusUnauthorizedInvalidNoToken = 4,
     BGStatusSimulationBusy = 5,
+    BGStatusRouteBusy = 6,
     NUMBGStatusCode
 };
 
@@ -0,0 +1,96 @@
+//=================================//
+// This file is part of BrainGenix //
+//=================================//
+
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <chrono>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+
+// Internal Libraries (BG convention: use <> instead of "")
+
+#include <RPC/AdmissionControl.h>
+
+
+
+namespace BG {
+namespace EVM {
+namespace API {
+
+
+AdmissionController::AdmissionController(RouteLimits _DefaultLimits, int _QueueTimeout_ms) {
+    DefaultLimits_ = _DefaultLimits;
+    QueueTimeout_ms_ = _QueueTimeout_ms;
+}
+
+AdmissionController::RouteState* AdmissionController::GetState(const std::string& _Route) {
+    std::unique_ptr<RouteState>& State = Routes_[_Route];
+    if (!State) {
+        State = std::make_unique<RouteState>();
+        State->Limits = DefaultLimits_;
+    }
+    return State.get();
+}
+
+void AdmissionController::SetRouteLimits(const std::string& _Route, RouteLimits _Limits) {
+    std::lock_guard<std::mutex> Lock(Mutex_);
+    RouteState* State = GetState(_Route);
+    State->Limits = _Limits;
+    State->SlotReleased.notify_all();
+}
+
+bool AdmissionController::Acquire(const std::string& _Route) {
+    std::unique_lock<std::mutex> Lock(Mutex_);
+    RouteState* State = GetState(_Route);
+
+    // Unlimited routes, or a free slot
+    if (State->Limits.MaxConcurrent <= 0 || State->Active < State->Limits.MaxConcurrent) {
+        State->Active++;
+        return true;
+    }
+
+    // Saturated, and no room to wait either
+    if (State->Queued >= State->Limits.MaxQueued) {
+        return false;
+    }
+
+    // Wait for a slot to be released
+    State->Queued++;
+    bool GotSlot = State->SlotReleased.wait_for(Lock, std::chrono::milliseconds(QueueTimeout_ms_), [State]() {
+        return State->Limits.MaxConcurrent <= 0 || State->Active < State->Limits.MaxConcurrent;
+    });
+    State->Queued--;
+    if (!GotSlot) {
+        return false;
+    }
+    State->Active++;
+    return true;
+}
+
+void AdmissionController::Release(const std::string& _Route) {
+    std::lock_guard<std::mutex> Lock(Mutex_);
+    RouteState* State = GetState(_Route);
+    State->Active--;
+    State->SlotReleased.notify_one();
+}
+
+
+AdmissionTicket::AdmissionTicket(AdmissionController& _Controller, const std::string& _Route) : Controller_(_Controller), Route_(_Route) {
+    Admitted_ = Controller_.Acquire(Route_);
+}
+
+AdmissionTicket::~AdmissionTicket() {
+    if (Admitted_) {
+        Controller_.Release(Route_);
+    }
+}
+
+bool AdmissionTicket::IsAdmitted() const {
+    return Admitted_;
+}
+
+
+}; // Close Namespace API
+}; // Close Namespace EVM
+}; // Close Namespace BG
@@ -0,0 +1,132 @@
+//=================================================================//
+// This file is part of the BrainGenix-EVM Neuron Emulation System //
+//=================================================================//
+
+/*
+    Description: This file provides per-route admission control for RPC calls.
+    Additional Notes: None
+    Date Created: 2024-05-08
+*/
+
+#pragma once
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <string>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+
+// Internal Libraries (BG convention: use <> instead of "")
+
+
+
+namespace BG {
+namespace EVM {
+namespace API {
+
+
+/**
+ * @brief Concurrency limits of a single route.
+ */
+struct RouteLimits {
+    int MaxConcurrent = 0; /**Maximum number of calls running at once, 0 means unlimited*/
+    int MaxQueued = 0;     /**Maximum number of calls waiting for a free slot, further calls are rejected*/
+};
+
+
+/**
+ * @brief Bounds the number of concurrently running and waiting calls for each route.
+ *
+ * A call first tries to take a running slot of its route. If none is free it waits in the
+ * route's queue, as long as the queue is not full. If the queue is full, or no slot frees up
+ * within the queue timeout, the call is rejected so that the caller can answer "busy" right away.
+ * Routes without explicitly set limits use the default limits.
+ */
+class AdmissionController {
+
+private:
+
+    struct RouteState {
+        RouteLimits Limits;
+        int Active = 0;
+        int Queued = 0;
+        std::condition_variable SlotReleased;
+    };
+
+    std::map<std::string, std::unique_ptr<RouteState>> Routes_; /**State of each route that has been seen so far*/
+    std::mutex Mutex_; /**Protects Routes_ and the states in it*/
+
+    RouteLimits DefaultLimits_; /**Limits used for routes that were not configured explicitly*/
+    int QueueTimeout_ms_ = 0; /**Longest time a queued call waits for a slot*/
+
+
+    /**
+     * @brief Returns the state of the given route, creating it with the default limits if needed.
+     * Mutex_ must be held by the caller.
+     */
+    RouteState* GetState(const std::string& _Route);
+
+public:
+
+    /**
+     * @brief Construct a new AdmissionController object
+     *
+     * @param _DefaultLimits Limits used for routes without explicit limits.
+     * @param _QueueTimeout_ms Longest time a queued call waits for a slot before being rejected.
+     */
+    AdmissionController(RouteLimits _DefaultLimits, int _QueueTimeout_ms);
+
+    /**
+     * @brief Sets the limits for the given route.
+     */
+    void SetRouteLimits(const std::string& _Route, RouteLimits _Limits);
+
+    /**
+     * @brief Tries to admit a call to the given route, may block while queued.
+     *
+     * @return true if admitted, Release() must then be called once the call is done.
+     * @return false if the route is saturated.
+     */
+    bool Acquire(const std::string& _Route);
+
+    /**
+     * @brief Returns the slot taken by a successful Acquire().
+     */
+    void Release(const std::string& _Route);
+
+};
+
+
+/**
+ * @brief Scoped admission, releases the slot (if one was taken) when it goes out of scope.
+ */
+class AdmissionTicket {
+
+private:
+
+    AdmissionController& Controller_;
+    std::string Route_;
+    bool Admitted_ = false;
+
+public:
+
+    AdmissionTicket(AdmissionController& _Controller, const std::string& _Route);
+    ~AdmissionTicket();
+
+    AdmissionTicket(const AdmissionTicket&) = delete;
+    AdmissionTicket& operator=(const AdmissionTicket&) = delete;
+
+    /**
+     * @brief Returns true if the call was admitted, false if the route was busy.
+     */
+    bool IsAdmitted() const;
+
+};
+
+
+}; // Close Namespace API
+}; // Close Namespace EVM
+}; // Close Namespace BG
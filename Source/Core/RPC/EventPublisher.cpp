@@ -0,0 +1,171 @@
+//=================================//
+// This file is part of BrainGenix //
+//=================================//
+
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <algorithm>
+#include <chrono>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <RPC/EventPublisher.h>
+
+
+
+namespace BG {
+namespace EVM {
+namespace API {
+
+
+EventPublisher::EventPublisher(SafeClient* _Client, Util::LazyLogger* _Log, int _FlushInterval_ms, int _MaxBatch, int _MaxRetries, int _MaxPending) {
+    Client_ = _Client;
+    Log_ = _Log;
+    FlushInterval_ms_ = _FlushInterval_ms > 0 ? _FlushInterval_ms : 1;
+    MaxBatch_ = _MaxBatch > 0 ? size_t(_MaxBatch) : 1;
+    MaxRetries_ = _MaxRetries > 0 ? _MaxRetries : 1;
+    MaxPending_ = _MaxPending > 0 ? size_t(_MaxPending) : 1;
+    Enabled_ = false;
+    FlushThread_ = std::thread(&EventPublisher::FlushThread, this);
+}
+
+EventPublisher::~EventPublisher() {
+    {
+        std::lock_guard<std::mutex> Lock(PendingMutex_);
+        RequestExit_ = true;
+    }
+    PendingCondition_.notify_one();
+    FlushThread_.join();
+}
+
+
+void EventPublisher::SetEnabled(bool _Enabled) {
+    Enabled_ = _Enabled;
+}
+
+void EventPublisher::Publish(const std::string& _JobID, JobEventType _Type, nlohmann::json _Payload) {
+    if (!Enabled_) {
+        return;
+    }
+
+    PendingEvent Event;
+    Event.IsTerminal_ = _Type == JOB_EVENT_COMPLETED;
+    Event.Event_ = std::move(_Payload);
+    Event.Event_["JobID"] = _JobID;
+    Event.Event_["Event"] = Event.IsTerminal_ ? "Completed" : "Progress";
+
+    bool IsFull = false;
+    {
+        std::lock_guard<std::mutex> Lock(PendingMutex_);
+        MergeLocked(_JobID, std::move(Event), true);
+        IsFull = Pending_.size() >= MaxBatch_;
+    }
+    if (IsFull) {
+        PendingCondition_.notify_one();
+    }
+}
+
+std::uint64_t EventPublisher::GetDroppedCount() {
+    std::lock_guard<std::mutex> Lock(PendingMutex_);
+    return Dropped_;
+}
+
+
+void EventPublisher::MergeLocked(const std::string& _JobID, PendingEvent&& _Event, bool _IsNewer) {
+    std::map<std::string, PendingEvent>::iterator it = Pending_.find(_JobID);
+    if (it == Pending_.end()) {
+
+        // When full, a completion takes the place of a progress event, those are only a snapshot anyway
+        if (Pending_.size() >= MaxPending_) {
+            std::map<std::string, PendingEvent>::iterator Victim = Pending_.end();
+            if (_Event.IsTerminal_) {
+                Victim = std::find_if(Pending_.begin(), Pending_.end(), [](const auto& _Entry) { return !_Entry.second.IsTerminal_; });
+            }
+            Dropped_++;
+            if (Victim == Pending_.end()) {
+                return;
+            }
+            Pending_.erase(Victim);
+        }
+        Pending_.emplace(_JobID, std::move(_Event));
+        return;
+    }
+
+    // A completion always wins over a progress event, otherwise the newer event wins
+    PendingEvent& Existing = it->second;
+    if (Existing.IsTerminal_ != _Event.IsTerminal_) {
+        if (_Event.IsTerminal_) {
+            Existing = std::move(_Event);
+        }
+    } else if (_IsNewer) {
+        Existing = std::move(_Event);
+    }
+}
+
+
+bool EventPublisher::Send(const std::map<std::string, PendingEvent>& _Batch) {
+    nlohmann::json Request;
+    nlohmann::json& Events = Request["Events"] = nlohmann::json::array();
+    for (const auto& [JobID, Event] : _Batch) {
+        Events.push_back(Event.Event_);
+    }
+
+    std::string Response;
+    return Client_->MakeJSONQuery(EVENT_PUSH_ROUTE, Request.dump(), &Response);
+}
+
+
+void EventPublisher::FlushThread() {
+
+    bool LastFailed = false; // After a failed send always wait a full interval, even if a batch is full
+    std::uint64_t ReportedDrops = 0;
+
+    while (true) {
+
+        std::map<std::string, PendingEvent> Batch;
+        bool IsExiting = false;
+        std::uint64_t NewDrops = 0;
+        {
+            std::unique_lock<std::mutex> Lock(PendingMutex_);
+            PendingCondition_.wait_for(Lock, std::chrono::milliseconds(FlushInterval_ms_), [this, LastFailed]() {
+                return RequestExit_ || (!LastFailed && Pending_.size() >= MaxBatch_);
+            });
+            IsExiting = RequestExit_;
+            Batch.swap(Pending_);
+            NewDrops = Dropped_ - ReportedDrops;
+            ReportedDrops = Dropped_;
+        }
+        if (NewDrops > 0) {
+            Log_->Log(6, [NewDrops]() { return "Job Event Queue Full Or API Service Unreachable, Dropped " + std::to_string(NewDrops) + " Job Events"; });
+        }
+
+        LastFailed = false;
+        if (!Batch.empty() && Enabled_) {
+            size_t BatchSize = Batch.size();
+            if (Send(Batch)) {
+                Log_->Log(0, [BatchSize]() { return "Pushed " + std::to_string(BatchSize) + " Job Events To API Service"; });
+            } else if (!IsExiting) {
+                LastFailed = true;
+                Log_->Log(3, [BatchSize]() { return "Failed To Push " + std::to_string(BatchSize) + " Job Events To API Service, Will Retry"; });
+                std::lock_guard<std::mutex> Lock(PendingMutex_);
+                for (auto& [JobID, Event] : Batch) {
+                    if (++Event.FailedSends_ >= MaxRetries_) {
+                        Dropped_++;
+                        continue;
+                    }
+                    MergeLocked(JobID, std::move(Event), false);
+                }
+            }
+        }
+
+        if (IsExiting) {
+            return;
+        }
+    }
+}
+
+
+}; // Close Namespace API
+}; // Close Namespace EVM
+}; // Close Namespace BG
@@ -0,0 +1,157 @@
+//=================================================================//
+// This file is part of the BrainGenix-EVM Neuron Emulation System //
+//=================================================================//
+
+/*
+    Description: This file provides batched, coalesced push of job events back to the API service.
+    Additional Notes: None
+    Date Created: 2024-05-20
+*/
+
+#pragma once
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+#include <nlohmann/json.hpp>
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <RPC/SafeClient.h>
+
+#include <Util/LazyLogger.h>
+
+
+
+namespace BG {
+namespace EVM {
+namespace API {
+
+
+#define EVENT_PUSH_ROUTE "EVM/PushEvents" /**Route on the API service that receives the event batches*/
+
+
+/**
+ * @brief Kind of a job event, completion is terminal.
+ */
+enum JobEventType {
+    JOB_EVENT_PROGRESS = 0,
+    JOB_EVENT_COMPLETED = 1
+};
+
+
+/**
+ * @brief Pushes job progress and completion events to the API service through the callback client.
+ *
+ * Events are not sent one by one. They are collected per job and flushed by a background thread,
+ * either every flush interval or as soon as a full batch is waiting, as one call to EVENT_PUSH_ROUTE:
+ *     {"Events": [{"JobID": "...", "Event": "Progress"|"Completed", ...}, ...]}
+ *
+ * Coalescing: only the newest event of each job is kept, except that a completion is never replaced
+ * by a progress event. A batch that fails to send is merged back under the same rule and retried.
+ * Until the callback is set up (SetEnabled(true)) published events are discarded, nobody is listening.
+ *
+ * Bounds: an event is dropped after MaxRetries failed sends, and at most MaxPending jobs have events
+ * waiting (once full, a completion replaces a waiting progress event, otherwise the new event is dropped).
+ * Dropped events are counted and reported by the flush thread.
+ */
+class EventPublisher {
+
+private:
+
+    struct PendingEvent {
+        nlohmann::json Event_;  /**Event object as it is sent*/
+        bool IsTerminal_ = false; /**True for completion events*/
+        int FailedSends_ = 0; /**Number of batches with this event that could not be sent*/
+    };
+
+    SafeClient* Client_ = nullptr; /**Callback client to the API service*/
+    Util::LazyLogger* Log_ = nullptr; /**Logging facade*/
+
+    int FlushInterval_ms_; /**Longest time an event waits before being sent*/
+    size_t MaxBatch_; /**A flush is started right away once this many jobs have pending events*/
+    int MaxRetries_; /**Failed sends after which an event is dropped*/
+    size_t MaxPending_; /**Maximum number of jobs with pending events*/
+
+    std::map<std::string, PendingEvent> Pending_; /**Newest unsent event of each job, by JobID*/
+    std::mutex PendingMutex_; /**Protects Pending_, Dropped_ and RequestExit_*/
+    std::condition_variable PendingCondition_; /**Signalled when a batch is full or when exiting*/
+    std::uint64_t Dropped_ = 0; /**Events dropped because of the retry or pending bound, reported by the flush thread*/
+    bool RequestExit_ = false; /**Set by the destructor, the flush thread makes one last attempt and exits*/
+    std::atomic_bool Enabled_; /**Set once the API service has registered its callback*/
+
+    std::thread FlushThread_; /**Sends the pending events*/
+
+
+    /**
+     * @brief Merges an event into Pending_ following the coalescing rule and the pending bound above, PendingMutex_ must be held.
+     *
+     * @param _JobID 
+     * @param _Event 
+     * @param _IsNewer False when putting back events of a failed batch, they then lose against anything queued since.
+     */
+    void MergeLocked(const std::string& _JobID, PendingEvent&& _Event, bool _IsNewer);
+
+    /**
+     * @brief Main loop of the flush thread.
+     */
+    void FlushThread();
+
+    /**
+     * @brief Sends one batch, returns false if the API service could not be reached.
+     */
+    bool Send(const std::map<std::string, PendingEvent>& _Batch);
+
+public:
+
+    /**
+     * @brief Construct a new EventPublisher object
+     *
+     * @param _Client Callback client to the API service.
+     * @param _Log Logging facade.
+     * @param _FlushInterval_ms Longest time an event waits before being sent.
+     * @param _MaxBatch Number of jobs with pending events that triggers an early flush.
+     * @param _MaxRetries Failed sends after which an event is dropped.
+     * @param _MaxPending Maximum number of jobs with pending events.
+     */
+    EventPublisher(SafeClient* _Client, Util::LazyLogger* _Log, int _FlushInterval_ms, int _MaxBatch, int _MaxRetries, int _MaxPending);
+
+    /**
+     * @brief Destroy the EventPublisher object
+     * Pending events get one last send attempt.
+     */
+    ~EventPublisher();
+
+
+    /**
+     * @brief Starts (or stops) sending, called once the API service has set up its callback.
+     */
+    void SetEnabled(bool _Enabled);
+
+    /**
+     * @brief Queues an event for the given job.
+     *
+     * @param _JobID Job the event belongs to.
+     * @param _Type Progress or completion.
+     * @param _Payload Object with the event details (e.g. "Stage", or "StatusCode" and "ResultHandle"), JobID and Event are added.
+     */
+    void Publish(const std::string& _JobID, JobEventType _Type, nlohmann::json _Payload);
+
+    /**
+     * @brief Returns the number of events dropped so far because of the retry or pending bound.
+     */
+    std::uint64_t GetDroppedCount();
+
+};
+
+
+
+}; // Close Namespace API
+}; // Close Namespace EVM
+}; // Close Namespace BG
@@ -0,0 +1,183 @@
+//=================================================================//
+// This file is part of the BrainGenix-EVM Neuron Emulation System //
+//=================================================================//
+
+/*
+    Description: This file provides declarative, single-pass decoding of route parameters into typed structs.
+    Additional Notes: None
+    Date Created: 2024-05-17
+*/
+
+#pragma once
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+#include <nlohmann/json.hpp>
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <Util/RequestArena.h>
+
+
+
+namespace BG {
+namespace EVM {
+namespace API {
+
+
+/**
+ * @brief Describes the parameters of a route and decodes requests into a struct of type S.
+ *
+ * The schema is built once when the route is registered, for example:
+ *
+ *     ParamSchema<PageParams> Schema;
+ *     Schema.Int("ResultHandle", &PageParams::ResultHandle)
+ *           .Int("Cursor", &PageParams::Cursor, false);
+ *
+ * Decode() then walks the request object once, looks up each key in the schema, checks its type and
+ * writes it straight into the struct. Numeric arrays are copied into vectors sized up front.
+ * Unknown keys are ignored, optional parameters keep the value the struct was initialized with.
+ * Problems are reported as a list of {"Param": <name>, "Error": <reason>} objects, the request itself
+ * is never serialized for this.
+ */
+template <typename S> class ParamSchema {
+
+private:
+
+    typedef std::function<const char*(const Util::ArenaJSON& _Value, S& _Params)> Decoder_t; /**Returns nullptr on success, otherwise the reason*/
+
+    struct Field {
+        std::string Name;
+        bool Required;
+        Decoder_t Decoder;
+    };
+
+    std::vector<Field> Fields_; /**Parameters in declaration order*/
+    std::unordered_map<std::string, size_t> FieldIndex_; /**Name to index into Fields_*/
+
+
+    ParamSchema& Add(const std::string& _Name, bool _Required, Decoder_t _Decoder) {
+        FieldIndex_[_Name] = Fields_.size();
+        Fields_.push_back(Field{_Name, _Required, std::move(_Decoder)});
+        return *this;
+    }
+
+    template <typename T> static const char* DecodeNumberVector(const Util::ArenaJSON& _Value, std::vector<T>& _Vector) {
+        if (!_Value.is_array()) {
+            return "wrong type (expected array)";
+        }
+        const Util::ArenaJSON::array_t& Elements = _Value.template get_ref<const Util::ArenaJSON::array_t&>();
+        _Vector.resize(Elements.size());
+        T* Output = _Vector.data();
+        for (const Util::ArenaJSON& Element : Elements) {
+            if (!Element.is_number()) {
+                return "wrong element type (expected number)";
+            }
+            *Output++ = Element.template get<T>();
+        }
+        return nullptr;
+    }
+
+public:
+
+    ParamSchema& Bool(const std::string& _Name, bool S::* _Member, bool _Required = true) {
+        return Add(_Name, _Required, [_Member](const Util::ArenaJSON& _Value, S& _Params) -> const char* {
+            if (!_Value.is_boolean()) {
+                return "wrong type (expected bool)";
+            }
+            _Params.*_Member = _Value.template get<bool>();
+            return nullptr;
+        });
+    }
+
+    ParamSchema& Int(const std::string& _Name, int S::* _Member, bool _Required = true) {
+        return Add(_Name, _Required, [_Member](const Util::ArenaJSON& _Value, S& _Params) -> const char* {
+            if (!_Value.is_number()) {
+                return "wrong type (expected number)";
+            }
+            _Params.*_Member = _Value.template get<int>();
+            return nullptr;
+        });
+    }
+
+    ParamSchema& Float(const std::string& _Name, float S::* _Member, bool _Required = true) {
+        return Add(_Name, _Required, [_Member](const Util::ArenaJSON& _Value, S& _Params) -> const char* {
+            if (!_Value.is_number()) {
+                return "wrong type (expected number)";
+            }
+            _Params.*_Member = _Value.template get<float>();
+            return nullptr;
+        });
+    }
+
+    ParamSchema& String(const std::string& _Name, std::string S::* _Member, bool _Required = true) {
+        return Add(_Name, _Required, [_Member](const Util::ArenaJSON& _Value, S& _Params) -> const char* {
+            if (!_Value.is_string()) {
+                return "wrong type (expected string)";
+            }
+            _Params.*_Member = _Value.template get_ref<const std::string&>();
+            return nullptr;
+        });
+    }
+
+    ParamSchema& VecInt(const std::string& _Name, std::vector<int> S::* _Member, bool _Required = true) {
+        return Add(_Name, _Required, [_Member](const Util::ArenaJSON& _Value, S& _Params) -> const char* {
+            return DecodeNumberVector(_Value, _Params.*_Member);
+        });
+    }
+
+    ParamSchema& VecFloat(const std::string& _Name, std::vector<float> S::* _Member, bool _Required = true) {
+        return Add(_Name, _Required, [_Member](const Util::ArenaJSON& _Value, S& _Params) -> const char* {
+            return DecodeNumberVector(_Value, _Params.*_Member);
+        });
+    }
+
+
+    /**
+     * @brief Decodes the request into _Params in a single pass over its keys.
+     *
+     * @param _Request Request parameters, must be an object.
+     * @param _Params Struct to fill in, optional members keep their current values if absent.
+     * @param _Errors Array to which {"Param", "Error"} objects are appended for every problem found.
+     * @return true if all parameters were valid and all required ones were present.
+     */
+    bool Decode(const Util::ArenaJSON& _Request, S& _Params, nlohmann::json& _Errors) const {
+        if (!_Request.is_object()) {
+            _Errors.push_back({{"Param", ""}, {"Error", "request must be an object"}});
+            return false;
+        }
+
+        bool Valid = true;
+        std::vector<bool> Seen(Fields_.size(), false);
+        for (const auto& [Key, Value] : _Request.items()) {
+            auto it = FieldIndex_.find(Key);
+            if (it == FieldIndex_.end()) {
+                continue;
+            }
+            Seen[it->second] = true;
+            const char* Error = Fields_[it->second].Decoder(Value, _Params);
+            if (Error != nullptr) {
+                _Errors.push_back({{"Param", Key}, {"Error", Error}});
+                Valid = false;
+            }
+        }
+
+        for (size_t i = 0; i < Fields_.size(); i++) {
+            if (Fields_[i].Required && !Seen[i]) {
+                _Errors.push_back({{"Param", Fields_[i].Name}, {"Error", "missing"}});
+                Valid = false;
+            }
+        }
+        return Valid;
+    }
+
+};
+
+
+}; // Close Namespace API
+}; // Close Namespace EVM
+}; // Close Namespace BG
@@ -21,14 +21,13 @@ namespace API {
 
 
 // Handy class for standard handler data.
-HandlerData::HandlerData(const std::string& _JSONRequest, BG::Common::Logger::LoggingSystem* _Logger, std::string _RoutePath) {
+HandlerData::HandlerData(const std::string& _JSONRequest, Util::LazyLogger* _Logger, std::string _RoutePath) : ArenaScope_(Arena_) {
 
     // ManTaskData = called_by_manager_task;
-    JSONRequestStr = _JSONRequest;
     Logger_ = _Logger;
     RoutePath_ = _RoutePath;
 
-    RequestJSON = nlohmann::json::parse(_JSONRequest);
+    RequestJSON = Util::ArenaJSON::parse(_JSONRequest);
 
     // bool isloadingsim = (ManTaskData != nullptr); // Man.IsLoadingSim();
     // if (isloadingsim && (_Source == "SimulationLoad")) { // *** PERHAPS WE CAN ALLOW THIS (AS WE USE LOCAL PARAMS NOW)?
@@ -56,6 +55,13 @@ HandlerData::HandlerData(const std::string& _JSONRequest, BG::Common::Logger::Lo
 }
 
 
+HandlerData::HandlerData(const Util::ArenaJSON& _JSONRequest, Util::LazyLogger* _Logger, std::string _RoutePath) : ArenaScope_(Arena_) {
+    Logger_ = _Logger;
+    RoutePath_ = _RoutePath;
+    RequestJSON = _JSONRequest;
+}
+
+
 // // See how this is used in Manager::SimulationCreate().
 // Simulator::Simulation* HandlerData::NewSimulation() {
 //     ThisSimulation = Man.MakeSimulation();
@@ -77,13 +83,13 @@ BGStatusCode HandlerData::GetStatus() const {
 //       nlohmann::json, as that is a way to accidentally a JSON object
 //       into JSON containing a single string, e.g. by accidentally
 //       passing ResponseJSON.dump() instead of ResponseJSON.
-// Note: Calling this from EVMRequest uses store==false, because we only
-//       want to store the calls from their actual handlers, not from the
-//       EVMRequest batch handler. We don't want to double-count the calls,
-//       and we want to store the individual oEVM, because they may be
-//       intended for different simulations (dependeing on their SimulationID).
-std::string HandlerData::ResponseAndStoreRequest(nlohmann::json& ResponseJSON,  bool store) {
-    // if (store && (Status == BGStatusCode::BGStatusSuccess)) {
+// Note: Requests are currently not stored. If that comes back, it must not
+//       happen for the EVMRequest batch response, only for the calls of the
+//       actual handlers. We don't want to double-count the calls, and we
+//       want to store the individual oEVM, because they may be intended for
+//       different simulations (dependeing on their SimulationID).
+std::string HandlerData::ResponseAndStoreRequest(nlohmann::json& ResponseJSON) {
+    // if (Status == BGStatusCode::BGStatusSuccess) {
     //     if (ThisSimulation != nullptr) {
     //         ThisSimulation->StoreRequestHandled(Source, _RH.at(Source).Route, JSONRequestStr);
     //     }
@@ -103,6 +109,15 @@ std::string HandlerData::ErrResponse(BGStatusCode _Status) {
 std::string HandlerData::ErrResponse() {
     return ErrResponse(int(Status));
 }
+nlohmann::json HandlerData::ErrResponseJSON(BGStatusCode _Status) {
+    Status = _Status;
+    nlohmann::json ResponseJSON;
+    ResponseJSON["StatusCode"] = int(_Status);
+    return ResponseJSON;
+}
+nlohmann::json HandlerData::ErrResponseJSON() {
+    return ErrResponseJSON(Status);
+}
 
 std::string HandlerData::ResponseWithID(const std::string& IDName, int IDValue) {
     nlohmann::json ResponseJSON;
@@ -123,31 +138,31 @@ std::string HandlerData::StringResponse(std::string _Key, std::string _Value) {
     return ResponseJSON.dump();
 }
 
-const nlohmann::json& HandlerData::ReqJSON() const {
+const Util::ArenaJSON& HandlerData::ReqJSON() const {
     return RequestJSON;
 }
 
-bool HandlerData::FindPar(const std::string& ParName, nlohmann::json::iterator& Iterator, nlohmann::json& _JSON) {
+bool HandlerData::FindPar(const std::string& ParName, Util::ArenaJSON::iterator& Iterator, Util::ArenaJSON& _JSON) {
     Iterator = _JSON.find(ParName);
     if (Iterator == _JSON.end()) {
-        Logger_->Log("Error Finding Parameter '" + ParName + "', Request Is: " + _JSON.dump(), 7);
+        Logger_->Log(7, [ParName, RoutePath = RoutePath_]() { return "Error Finding Parameter '" + ParName + "' In Route '" + RoutePath + "'"; });
         Status = BGStatusCode::BGStatusInvalidParametersPassed;
         return false;
     }
     return true;
 }
 
-bool HandlerData::FindPar(const std::string& ParName, nlohmann::json::iterator& Iterator) {
+bool HandlerData::FindPar(const std::string& ParName, Util::ArenaJSON::iterator& Iterator) {
     return FindPar(ParName, Iterator, RequestJSON);
 }
 
-bool HandlerData::GetParBool(const std::string& ParName, bool& Value, nlohmann::json& _JSON) {
-    nlohmann::json::iterator it;
+bool HandlerData::GetParBool(const std::string& ParName, bool& Value, Util::ArenaJSON& _JSON) {
+    Util::ArenaJSON::iterator it;
     if (!FindPar(ParName, it, _JSON)) {
         return false;
     }
     if (!it.value().is_boolean()) {
-        Logger_->Log("Error Parameter '" + ParName + "', Wrong Type (expected bool) Request Is: " + _JSON.dump(), 7);
+        Logger_->Log(7, [ParName, RoutePath = RoutePath_]() { return "Error Parameter '" + ParName + "', Wrong Type (expected bool) In Route '" + RoutePath + "'"; });
         Status = BGStatusCode::BGStatusInvalidParametersPassed;
         return false;
     }
@@ -159,13 +174,13 @@ bool HandlerData::GetParBool(const std::string& ParName, bool& Value) {
     return GetParBool(ParName, Value, RequestJSON);
 }
 
-bool HandlerData::GetParInt(const std::string& ParName, int& Value, nlohmann::json& _JSON) {
-    nlohmann::json::iterator it;
+bool HandlerData::GetParInt(const std::string& ParName, int& Value, Util::ArenaJSON& _JSON) {
+    Util::ArenaJSON::iterator it;
     if (!FindPar(ParName, it, _JSON)) {
         return false;
     }
     if (!it.value().is_number()) {
-        Logger_->Log("Error Parameter '" + ParName + "', Wrong Type (expected number) Request Is: " + _JSON.dump(), 7);
+        Logger_->Log(7, [ParName, RoutePath = RoutePath_]() { return "Error Parameter '" + ParName + "', Wrong Type (expected number) In Route '" + RoutePath + "'"; });
         Status = BGStatusCode::BGStatusInvalidParametersPassed;
         return false;
     }
@@ -177,13 +192,13 @@ bool HandlerData::GetParInt(const std::string& ParName, int& Value) {
     return GetParInt(ParName, Value, RequestJSON);
 }
 
-bool HandlerData::GetParFloat(const std::string& ParName, float& Value, nlohmann::json& _JSON) {
-    nlohmann::json::iterator it;
+bool HandlerData::GetParFloat(const std::string& ParName, float& Value, Util::ArenaJSON& _JSON) {
+    Util::ArenaJSON::iterator it;
     if (!FindPar(ParName, it, _JSON)) {
         return false;
     }
     if (!it.value().is_number()) {
-        Logger_->Log("Error Parameter '" + ParName + "', Wrong Type (expected number) Request Is: " + _JSON.dump(), 7);
+        Logger_->Log(7, [ParName, RoutePath = RoutePath_]() { return "Error Parameter '" + ParName + "', Wrong Type (expected number) In Route '" + RoutePath + "'"; });
         Status = BGStatusCode::BGStatusInvalidParametersPassed;
         return false;
     }
@@ -195,13 +210,13 @@ bool HandlerData::GetParFloat(const std::string& ParName, float& Value) {
     return GetParFloat(ParName, Value, RequestJSON);
 }
 
-bool HandlerData::GetParString(const std::string& ParName, std::string& Value, nlohmann::json& _JSON) {
-    nlohmann::json::iterator it;
+bool HandlerData::GetParString(const std::string& ParName, std::string& Value, Util::ArenaJSON& _JSON) {
+    Util::ArenaJSON::iterator it;
     if (!FindPar(ParName, it, _JSON)) {
         return false;
     }
     if (!it.value().is_string()) {
-        Logger_->Log("Error Parameter '" + ParName + "', Wrong Type (expected string) Request Is: " + _JSON.dump(), 7);
+        Logger_->Log(7, [ParName, RoutePath = RoutePath_]() { return "Error Parameter '" + ParName + "', Wrong Type (expected string) In Route '" + RoutePath + "'"; });
         Status = BGStatusCode::BGStatusInvalidParametersPassed;
         return false;
     }
@@ -214,19 +229,20 @@ bool HandlerData::GetParString(const std::string& ParName, std::string& Value) {
 }
 
 
-bool HandlerData::GetParVecInt(const std::string& ParName, std::vector<int>& Value, nlohmann::json& _JSON) {
-    nlohmann::json::iterator it;
+bool HandlerData::GetParVecInt(const std::string& ParName, std::vector<int>& Value, Util::ArenaJSON& _JSON) {
+    Util::ArenaJSON::iterator it;
     if (!FindPar(ParName, it, _JSON)) {
         return false;
     }
     if (!it.value().is_array()) {
-        Logger_->Log("Error Parameter '" + ParName + "', Wrong Type (expected array) Request Is: " + _JSON.dump(), 7);
+        Logger_->Log(7, [ParName, RoutePath = RoutePath_]() { return "Error Parameter '" + ParName + "', Wrong Type (expected array) In Route '" + RoutePath + "'"; });
         Status = BGStatusCode::BGStatusInvalidParametersPassed;
         return false;
     }
+    Value.reserve(Value.size() + it.value().size());
     for (auto& element : it.value()) {
         if (!element.is_number()) {
-            Logger_->Log("Error Parameter '" + ParName + "', Wrong Type (expected int) Request Is: " + _JSON.dump(), 7);
+            Logger_->Log(7, [ParName, RoutePath = RoutePath_]() { return "Error Parameter '" + ParName + "', Wrong Type (expected int) In Route '" + RoutePath + "'"; });
             Status = BGStatusCode::BGStatusInvalidParametersPassed;
             return false;
         }
@@ -240,16 +256,17 @@ bool HandlerData::GetParVecInt(const std::string& ParName, std::vector<int>& Val
 }
 
 // If Parname="" then _JSON.is_array() must be true.
-bool HandlerData::GetParVecFloat(const std::string& ParName, std::vector<float>& Value, nlohmann::json& _JSON) {
+bool HandlerData::GetParVecFloat(const std::string& ParName, std::vector<float>& Value, Util::ArenaJSON& _JSON) {
     if (ParName.empty()) {
         if (!_JSON.is_array()) {
-            Logger_->Log("Error Parameter '" + ParName + "', Wrong Type (expected array) Request Is: " + _JSON.dump(), 7);
+            Logger_->Log(7, [ParName, RoutePath = RoutePath_]() { return "Error Parameter '" + ParName + "', Wrong Type (expected array) In Route '" + RoutePath + "'"; });
             Status = BGStatusCode::BGStatusInvalidParametersPassed;
             return false;
         }
+        Value.reserve(Value.size() + _JSON.size());
         for (auto& element : _JSON) {
             if (!element.is_number()) {
-                Logger_->Log("Error Parameter '" + ParName + "', Wrong Type (expected float) Request Is: " + _JSON.dump(), 7);
+                Logger_->Log(7, [ParName, RoutePath = RoutePath_]() { return "Error Parameter '" + ParName + "', Wrong Type (expected float) In Route '" + RoutePath + "'"; });
                 Status = BGStatusCode::BGStatusInvalidParametersPassed;
                 return false;
             }
@@ -257,18 +274,19 @@ bool HandlerData::GetParVecFloat(const std::string& ParName, std::vector<float>&
         }
         return true;
     } else {
-        nlohmann::json::iterator it;
+        Util::ArenaJSON::iterator it;
         if (!FindPar(ParName, it, _JSON)) {
             return false;
         }
         if (!it.value().is_array()) {
-            Logger_->Log("Error Parameter '" + ParName + "', Wrong Type (expected array) Request Is: " + _JSON.dump(), 7);
+            Logger_->Log(7, [ParName, RoutePath = RoutePath_]() { return "Error Parameter '" + ParName + "', Wrong Type (expected array) In Route '" + RoutePath + "'"; });
             Status = BGStatusCode::BGStatusInvalidParametersPassed;
             return false;
         }
+        Value.reserve(Value.size() + it.value().size());
         for (auto& element : it.value()) {
             if (!element.is_number()) {
-                Logger_->Log("Error Parameter '" + ParName + "', Wrong Type (expected float) Request Is: " + _JSON.dump(), 7);
+                Logger_->Log(7, [ParName, RoutePath = RoutePath_]() { return "Error Parameter '" + ParName + "', Wrong Type (expected float) In Route '" + RoutePath + "'"; });
                 Status = BGStatusCode::BGStatusInvalidParametersPassed;
                 return false;
             }
@@ -20,12 +20,15 @@
 
 // Internal Libraries (BG convention: use <> instead of "")
 #include <BG/Common/Logger/Logger.h>
+#include <Util/LazyLogger.h>
 
 // #include <Simulator/Structs/Simulation.h>
 
 // #include <RPC/ManagerTaskData.h>
 #include <RPC/APIStatusCode.h>
 
+#include <Util/RequestArena.h>
+
 
 namespace BG {
 namespace EVM {
@@ -38,24 +41,34 @@ namespace API {
 
 
 // Handy class for standard handler data.
+// The parsed request lives in a per-request arena that is released in one step when the HandlerData
+// goes out of scope, so HandlerData must be created and destroyed on the same thread (e.g. on the stack).
 class HandlerData {
 
 protected:
     // ManagerTaskData* ManTaskData;
     // Simulations SimVec = nullptr;
 
-    BG::Common::Logger::LoggingSystem* Logger_ = nullptr; /**Pointer to the instance of the logging system*/
+    Util::RequestArena Arena_; /**Backs all nodes of RequestJSON, must be declared before it*/
+    Util::ScopedRequestArena ArenaScope_; /**Makes Arena_ the current arena of this thread while the handler runs*/
+
+    Util::LazyLogger* Logger_ = nullptr; /**Pointer to the logging facade, messages are only formatted if their level is enabled*/
 
-    std::string JSONRequestStr;
     std::string RoutePath_; /**Path that is this route*/
-    nlohmann::json RequestJSON;
+    Util::ArenaJSON RequestJSON;
     BGStatusCode Status = BGStatusSuccess;
 
     int SimulationID = -1;
     // Simulator::Simulation* ThisSimulation = nullptr;
 
 public:
-    HandlerData(const std::string& _JSONRequest, BG::Common::Logger::LoggingSystem* _Logger, std::string _RoutePath);
+    HandlerData(const std::string& _JSONRequest, Util::LazyLogger* _Logger, std::string _RoutePath);
+
+    // Used by JSON-native handlers (see AddJSONRoute), takes the already parsed request.
+    HandlerData(const Util::ArenaJSON& _JSONRequest, Util::LazyLogger* _Logger, std::string _RoutePath);
+
+    HandlerData(const HandlerData&) = delete;
+    HandlerData& operator=(const HandlerData&) = delete;
 
     // See how this is used in Manager::SimulationCreate().
     // Simulator::Simulation* NewSimulation();
@@ -69,16 +82,20 @@ public:
     //       nlohmann::json, as that is a way to accidentally a JSON object
     //       into JSON containing a single string, e.g. by accidentally
     //       passing ResponseJSON.dump() instead of ResponseJSON.
-    // Note: Calling this from EVMRequest uses store==false, because we only
-    //       want to store the calls from their actual handlers, not from the
-    //       EVMRequest batch handler. We don't want to double-count the calls,
-    //       and we want to store the individual oEVM, because they may be
-    //       intended for different simulations (dependeing on their SimulationID).
-    std::string ResponseAndStoreRequest(nlohmann::json& ResponseJSON, bool store = true);
+    // Note: Requests are currently not stored. If that comes back, it must not
+    //       happen for the EVMRequest batch response, only for the calls of the
+    //       actual handlers. We don't want to double-count the calls, and we
+    //       want to store the individual oEVM, because they may be intended for
+    //       different simulations (dependeing on their SimulationID).
+    std::string ResponseAndStoreRequest(nlohmann::json& ResponseJSON);
     std::string ErrResponse(int _Status);
     std::string ErrResponse(BGStatusCode _Status);
     std::string ErrResponse();
 
+    // JSON-native equivalent of ErrResponse(), for handlers registered with AddJSONRoute.
+    nlohmann::json ErrResponseJSON(BGStatusCode _Status);
+    nlohmann::json ErrResponseJSON();
+
     std::string ResponseWithID(const std::string& IDName, int IDValue);
     std::string ResponseWithID(const std::string& IDName, const std::string& IDValue);
     std::string StringResponse(std::string _Key, std::string _Value);
@@ -86,32 +103,32 @@ public:
 
     // Simulator::Simulation* Sim() const;
 
-    const nlohmann::json& ReqJSON() const;
+    const Util::ArenaJSON& ReqJSON() const;
 
-    bool FindPar(const std::string& ParName, nlohmann::json::iterator& Iterator, nlohmann::json& _JSON);
-    bool FindPar(const std::string& ParName, nlohmann::json::iterator& Iterator);
+    bool FindPar(const std::string& ParName, Util::ArenaJSON::iterator& Iterator, Util::ArenaJSON& _JSON);
+    bool FindPar(const std::string& ParName, Util::ArenaJSON::iterator& Iterator);
 
-    bool GetParBool(const std::string& ParName, bool& Value, nlohmann::json& _JSON);
+    bool GetParBool(const std::string& ParName, bool& Value, Util::ArenaJSON& _JSON);
     bool GetParBool(const std::string& ParName, bool& Value);
 
-    bool GetParInt(const std::string& ParName, int& Value, nlohmann::json& _JSON);
+    bool GetParInt(const std::string& ParName, int& Value, Util::ArenaJSON& _JSON);
     bool GetParInt(const std::string& ParName, int& Value);
 
-    bool GetParFloat(const std::string& ParName, float& Value, nlohmann::json& _JSON);
+    bool GetParFloat(const std::string& ParName, float& Value, Util::ArenaJSON& _JSON);
     bool GetParFloat(const std::string& ParName, float& Value);
 
-    bool GetParString(const std::string& ParName, std::string& Value, nlohmann::json& _JSON);
+    bool GetParString(const std::string& ParName, std::string& Value, Util::ArenaJSON& _JSON);
     bool GetParString(const std::string& ParName, std::string& Value);
 
     // bool GetParVec3FromJSON(const std::string& ParName, Simulator::Geometries::Vec3D& Value, nlohmann::json& _JSON, const std::string& Units = "um");
 
     // bool GetParVec3(const std::string& ParName, Simulator::Geometries::Vec3D& Value, const std::string& Units = "um");
 
-    bool GetParVecInt(const std::string& ParName, std::vector<int>& Value, nlohmann::json& _JSON);
+    bool GetParVecInt(const std::string& ParName, std::vector<int>& Value, Util::ArenaJSON& _JSON);
     bool GetParVecInt(const std::string& ParName, std::vector<int>& Value);
 
 
-    bool GetParVecFloat(const std::string& ParName, std::vector<float>& Value, nlohmann::json& _JSON);
+    bool GetParVecFloat(const std::string& ParName, std::vector<float>& Value, Util::ArenaJSON& _JSON);
     bool GetParVecFloat(const std::string& ParName, std::vector<float>& Value);
 
 };
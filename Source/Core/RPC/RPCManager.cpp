@@ -5,6 +5,8 @@
 
 // Standard Libraries (BG convention: use <> instead of "")
 #include <thread>
+#include <algorithm>
+#include <exception>
 
 // Third-Party Libraries (BG convention: use <> instead of "")
 
@@ -23,7 +25,9 @@ namespace API {
 
 RPCManager::RPCManager(Config::Config* _Config, BG::Common::Logger::LoggingSystem* _Logger) {
 
+    Config_ = _Config;
     Logger_ = _Logger;
+    Log_ = std::make_unique<Util::LazyLogger>(_Logger, _Config->LogMinLevel, _Config->LogQueueSize);
 
     // Initialize Server
     std::string ServerHost = _Config->Host;
@@ -32,47 +36,135 @@ RPCManager::RPCManager(Config::Config* _Config, BG::Common::Logger::LoggingSyste
     // Create a unique pointer to the RPC server and initialize it with the provided port number
     RPCServer_ = std::make_unique<rpc::server>(ServerPort);
 
-    APIClient_ = std::make_unique<SafeClient>(_Logger);
+    APIClient_ = std::make_unique<SafeClient>(_Logger, _Config->ConnectionPoolSize);
+    APIClient_->SetSharedMemoryTransport(_Config->UseSharedMemoryTransport);
+    APIClient_->SetSingleFlight(_Config->SingleFlight);
+    APIClient_->SetHedging(_Config->Hedging);
+    APIClient_->SetHealthCheckTiming(_Config->IdleProbeInterval_ms, _Config->ReconnectBackoffMin_ms, _Config->ReconnectBackoffMax_ms);
+    Events_ = std::make_unique<EventPublisher>(APIClient_.get(), Log_.get(), _Config->EventFlushInterval_ms, _Config->EventMaxBatch, _Config->EventMaxRetries, _Config->EventMaxPending);
+    NESRouter_ = std::make_unique<NESRouter>(_Logger, *_Config, APIClient_.get());
+
+    BatchPool_ = std::make_unique<Util::ThreadPool>(_Config->BatchWorkerThreads);
+    _Logger->Log("Started EVM Batch Pool With '" + std::to_string(BatchPool_->GetNumThreads()) + "' Threads", 4);
+
+    ComputePool_ = std::make_unique<Util::ThreadPool>(_Config->ComputeWorkerThreads);
+    _Logger->Log("Started EVM Compute Pool With '" + std::to_string(ComputePool_->GetNumThreads()) + "' Threads", 4);
+
+    RouteLimits DefaultLimits;
+    DefaultLimits.MaxConcurrent = _Config->RouteMaxConcurrent;
+    DefaultLimits.MaxQueued = _Config->RouteMaxQueued;
+    Admission_ = std::make_unique<AdmissionController>(DefaultLimits, _Config->RouteQueueTimeout_ms);
+
+    RequestCache_ = std::make_unique<RequestCache>(_Config->RequestCacheMaxEntries, _Config->RequestCacheTTL_ms);
+
+    int ThreadCount = std::thread::hardware_concurrency();
+
+    // EVM batches may never take every server thread, so GetAPIVersion heartbeats always get through.
+    // They are not queued either, since a queued call would hold on to the last thread while waiting.
+    SetRouteLimits("EVM", std::max(1, ThreadCount - 1), 0);
 
     // Register Basic Routes
     // Add predefined routes to the RPC server
-    AddRoute("GetAPIVersion", _Logger, &GetAPIVersion);
-    AddRoute("Echo", _Logger, &Echo);
-    AddRoute("EVM", Logger_, [this](std::string RequestJSON){ return EVMRequest(RequestJSON);});
-    AddRoute("SetCallback", Logger_, [this](std::string RequestJSON){ return SetupCallback(RequestJSON);});
+    BindRoute("GetAPIVersion", &GetAPIVersion);
+    BindRoute("Echo", &Echo);
+    BindRoute("EVM", [this](std::string RequestJSON){ return EVMRequest(RequestJSON);});
+    BindRoute("EVMParallel", [this](std::string RequestJSON){ return EVMRequest(RequestJSON, -1, true);});
+    BindRoute("EVMBinary", [this](std::vector<std::uint8_t> RequestMsgPack){ return EVMBinaryRequest(RequestMsgPack);});
+    BindRoute("EVMBinaryParallel", [this](std::vector<std::uint8_t> RequestMsgPack){ return EVMBinaryRequest(RequestMsgPack, true);});
+    BindRoute("SetCallback", [this](std::string RequestJSON){ return SetupCallback(RequestJSON);});
+    BindRoute("NESCompleted", [this](std::string RequestJSON){ return NESCompleted(RequestJSON);});
 
     // Add EVM Routes
-    AddRoute("Debug/Echo", std::bind(Echo, std::placeholders::_1));
+    AddJSONRoute("Debug/Echo", [](const Util::ArenaJSON& _Request){ return nlohmann::json(_Request); });
     AddRoute("Debug/DoubleEcho", std::bind(&RPCManager::DoubleEcho, this, std::placeholders::_1));
     // AddRoute("Debug/Echo", std::bind(&RPCManager::Echo, this, std::placeholders::_1));
-    
+
+}
+
+RPCManager::~RPCManager() {
+    // Destructor
+    // No explicit cleanup needed as smart pointers manage the RPC server's memory
+}
+
+void RPCManager::Start() {
+    if (Started_) {
+        return;
+    }
+    Started_ = true;
 
     int ThreadCount = std::thread::hardware_concurrency();
-    _Logger->Log("Starting RPC Server With '" + std::to_string(ThreadCount) + "' Threads", 5);
+    Logger_->Log("Starting RPC Server With '" + std::to_string(ThreadCount) + "' Threads", 5);
     
     // Start the RPC server asynchronously with the specified thread count
     RPCServer_->async_run(ThreadCount);
 }
 
-RPCManager::~RPCManager() {
-    // Destructor
-    // No explicit cleanup needed as smart pointers manage the RPC server's memory
+
+
+void RPCManager::AddRoute(std::string _RouteHandle, std::function<std::string(std::string _JSONRequest)> _Function, RouteWeight _Weight) {
+    RouteAndHandler Handler;
+    Handler.Route_ = _RouteHandle;
+    Handler.Handler_ = _Function;
+    Handler.Weight_ = _Weight;
+    AddRequestHandler(_RouteHandle, Handler);
 }
 
+void RPCManager::AddJSONRoute(std::string _RouteHandle, JSONHandler_t _Function, RouteWeight _Weight) {
+    RouteAndHandler Handler;
+    Handler.Route_ = _RouteHandle;
+    Handler.JSONHandler_ = _Function;
+    Handler.Weight_ = _Weight;
+    AddRequestHandler(_RouteHandle, Handler);
+}
 
+void RPCManager::SetRouteLimits(std::string _RouteHandle, int _MaxConcurrent, int _MaxQueued) {
+    Logger_->Log("Limiting Route '" + _RouteHandle + "' To " + std::to_string(_MaxConcurrent) + " Concurrent And " + std::to_string(_MaxQueued) + " Queued Calls", 4);
+    RouteLimits Limits;
+    Limits.MaxConcurrent = _MaxConcurrent;
+    Limits.MaxQueued = _MaxQueued;
+    Admission_->SetRouteLimits(_RouteHandle, Limits);
+}
 
-void RPCManager::AddRoute(std::string _RouteHandle, std::function<std::string(std::string _JSONRequest)> _Function) {
-    Logger_->Log("Registering Callback For Route '" + _RouteHandle + "'", 4);
-    RequestHandlers_.insert(std::pair<std::string, std::function<std::string(std::string _JSONRequest)>>(_RouteHandle, _Function));
-    // RouteAndHandler Handler;
-    // Handler.Route_ = _RouteHandle;
-    // Handler.Handler_ = _Function;
-    // AddRequestHandler(_RouteHandle, Handler);
+void RPCManager::AddRequestHandler(std::string _RouteName, RouteAndHandler _Handler) {
+    if (Started_) {
+        Logger_->Log("Cannot Register Route '" + _RouteName + "' After The RPC Server Was Started", 8);
+        return;
+    }
+    bool IsHeavy = _Handler.Weight_ == ROUTE_HEAVY;
+    Log_->Log(4, [_RouteName, IsHeavy]() { return "Registering Callback For Route '" + _RouteName + "'" + (IsHeavy ? " (Heavy)" : ""); });
+
+    // rpclib answers on the thread that received the call, so heavy calls hold a server thread while they run.
+    // They are bounded like the compute pool instead, so they cannot take more threads than there are cores for them.
+    if (IsHeavy) {
+        SetRouteLimits(_RouteName, int(ComputePool_->GetNumThreads()), Config_->RouteMaxQueued);
+    }
+    RequestHandlers_.insert(std::pair<std::string, RouteAndHandler>(_RouteName, _Handler));
 }
 
 
 
 
+Config::Config* RPCManager::GetConfig() {
+    return Config_;
+}
+
+SafeClient* RPCManager::GetAPIClient() {
+    return APIClient_.get();
+}
+
+NESRouter* RPCManager::GetNESRouter() {
+    return NESRouter_.get();
+}
+
+EventPublisher* RPCManager::GetEventPublisher() {
+    return Events_.get();
+}
+
+void RPCManager::SubmitBackground(std::function<void()> _Task) {
+    ComputePool_->Enqueue(std::move(_Task));
+}
+
+
 std::string RPCManager::SetupCallback(std::string _JSONRequest) {
 
     nlohmann::json Params = nlohmann::json::parse(_JSONRequest);
@@ -82,6 +174,7 @@ std::string RPCManager::SetupCallback(std::string _JSONRequest) {
     APIClient_->SetHostPort(Host, Port);
     APIClient_->SetTimeout(2500);
     APIClient_->Reconnect();
+    Events_->SetEnabled(true);
 
     Logger_->Log("System Callback To API Service Registered To '" + Host + ":" + std::to_string(Port) + "'", 5);
 
@@ -89,6 +182,18 @@ std::string RPCManager::SetupCallback(std::string _JSONRequest) {
 }
 
 
+std::string RPCManager::NESCompleted(std::string _JSONRequest) {
+    Log_->Log(1, [_JSONRequest]() { return "NES Reported Completion '" + _JSONRequest + "'"; });
+    nlohmann::json Params = nlohmann::json::parse(_JSONRequest, nullptr, false);
+    std::string Backend;
+    if (Params.is_object() && Params.contains("Backend") && Params["Backend"].is_string()) {
+        Backend = Params["Backend"].get<std::string>();
+    }
+    NESRouter_->NotifyCompleted(Backend);
+    return "{\"StatusCode\": 0}";
+}
+
+
 /**
  * This expects requests of the following format:
  * [
@@ -104,101 +209,328 @@ std::string RPCManager::SetupCallback(std::string _JSONRequest) {
  *   },
  *   <more requests>
  * ]
+ *
+ * If _Parallel is set (the "EVMParallel" route), independent requests are run concurrently.
+ * A request that must wait for earlier ones lists their ReqIDs:
+ *   {
+ *     "ReqID": <request-id>,
+ *     "DependsOn": [<earlier-request-id>, ...],
+ *     "AddBSNeuron": { ... }
+ *   }
+ *
+ * A request may also carry a "ClientToken" string. A retry with the same route and token
+ * is not run again but gets the first attempt's response, see RequestCache.
  */
-std::string RPCManager::EVMRequest(std::string _JSONRequest, int _SimulationIDOverride) { // Generic JSON-based EVM requests.
+std::string RPCManager::EVMRequest(std::string _JSONRequest, int _SimulationIDOverride, bool _Parallel) { // Generic JSON-based EVM requests.
+
+    // All EVM routes share one admission slot pool, see constructor
+    AdmissionTicket Ticket(*Admission_, "EVM");
+    if (!Ticket.IsAdmitted()) {
+        Log_->Log(6, "EVM Request Rejected, Too Many Concurrent Requests");
+        return "{\"StatusCode\":" + std::to_string(int(BGStatusCode::BGStatusRouteBusy)) + "}";
+    }
 
     // Parse Request
     //Logger_->Log(_JSONRequest, 3);
-    API::HandlerData Handle(_JSONRequest, Logger_, "EVM");
+    API::HandlerData Handle(_JSONRequest, Log_.get(), "EVM");
     if (Handle.HasError()) {
         return Handle.ErrResponse();
     }
 
     if (!Handle.ReqJSON().is_array()) {
-        Logger_->Log("Bad format. Must be array of requests.", 8);
+        Log_->Log(8, "Bad format. Must be array of requests.");
         return Handle.ErrResponse(API::BGStatusCode::BGStatusInvalidParametersPassed);       
     }
 
     // Build Response
+    nlohmann::json ResponseJSON = EVMHandleBatch(Handle.ReqJSON(), _SimulationIDOverride, _Parallel);
+
+    std::string Response = Handle.ResponseAndStoreRequest(ResponseJSON); // See comments at ResponseAndStoreRequest().
+    if (Log_->IsEnabled(0)) { // Only copy the response if it is going to be logged
+        if (Response.length() < 1024) { 
+            Log_->Log(0, [Response]() { return "DEBUG --> Responding: " + Response; }); // For DEBUG
+        } else {
+            Log_->Log(0, "DEBUG --> Response Omitted Due To Length"); // For DEBUG
+        }
+    }
+    // if (!IsLoadingSim()) {
+    //     std::cout << "DEBUG ---> Responding: " << ResponseJSON.dump() << '\n'; std::cout.flush();
+    // }
+
+    return Response;
+}
+
+
+
+std::vector<std::uint8_t> RPCManager::EVMBinaryRequest(const std::vector<std::uint8_t>& _MsgPackRequest, bool _Parallel) {
+
+    AdmissionTicket Ticket(*Admission_, "EVM");
+    if (!Ticket.IsAdmitted()) {
+        Log_->Log(6, "EVM Request Rejected, Too Many Concurrent Requests");
+        nlohmann::json ErrorJSON;
+        ErrorJSON["StatusCode"] = int(BGStatusCode::BGStatusRouteBusy);
+        return nlohmann::json::to_msgpack(ErrorJSON);
+    }
+
+    // Decode Request into a per-request arena, like HandlerData does for the JSON routes
+    Util::RequestArena Arena;
+    Util::ScopedRequestArena ArenaScope(Arena);
+    Util::ArenaJSON RequestJSON;
+    try {
+        RequestJSON = Util::ArenaJSON::from_msgpack(_MsgPackRequest);
+    } catch (nlohmann::json::parse_error& e) {
+        std::string Error = e.what();
+        Log_->Log(8, [Error]() { return "Bad format. Unable to decode MessagePack request: " + Error; });
+        nlohmann::json ErrorJSON;
+        ErrorJSON["StatusCode"] = int(BGStatusCode::BGStatusInvalidParametersPassed);
+        return nlohmann::json::to_msgpack(ErrorJSON);
+    }
+
+    if (!RequestJSON.is_array()) {
+        Log_->Log(8, "Bad format. Must be array of requests.");
+        nlohmann::json ErrorJSON;
+        ErrorJSON["StatusCode"] = int(BGStatusCode::BGStatusInvalidParametersPassed);
+        return nlohmann::json::to_msgpack(ErrorJSON);
+    }
+
+    return nlohmann::json::to_msgpack(EVMHandleBatch(RequestJSON, -1, _Parallel));
+}
+
+
+nlohmann::json RPCManager::EVMHandleBatch(const Util::ArenaJSON& _Requests, int _SimulationIDOverride, bool _Parallel) {
+    if (_Parallel) {
+        return EVMHandleBatchParallel(_Requests, _SimulationIDOverride);
+    }
+
     nlohmann::json ResponseJSON = nlohmann::json::array(); // Create empty array for the list of responses.
+    ResponseJSON.get_ref<nlohmann::json::array_t&>().reserve(_Requests.size());
 
     // For each request in the JSON list:
-    for (const auto& req : Handle.ReqJSON()) {
+    for (const auto& req : _Requests) {
+        ResponseJSON.push_back(EVMHandleItem(req, _SimulationIDOverride));
+    }
+    return ResponseJSON;
+}
+
+
+nlohmann::json RPCManager::EVMHandleItem(const Util::ArenaJSON& _Request, int _SimulationIDOverride) {
+
+    int ReqID = -1;
+    //int SimulationID = -1;
+    std::string ReqFunc;
+    const Util::ArenaJSON* ReqParams = nullptr;
+    std::string ClientToken;
+    nlohmann::json ReqResponseJSON;
+
+    // Get the mandatory components of a request:
+    for (const auto& [req_key, req_value]: _Request.items()) {
+        if (req_key == "ReqID") {
+            ReqID = req_value.template get<int>();
+        } else if (req_key == "DependsOn") {
+            continue; // Only used for scheduling, see EVMHandleBatchParallel()
+        } else if (req_key == "ClientToken") {
+            ClientToken = req_value.template get<std::string>();
+        //} else if (req_key == "SimID") {
+        //    SimulationID = req_value.template get<int>();
+        } else {
+            ReqFunc = req_key;
+            ReqParams = &req_value;
+        }
+    }
+    // if (BadReqID(ReqID)) { // e.g. < highest request ID already handled
+    //     ReqResponseJSON["ReqID"] = ReqID;
+    //     ReqResponseJSON["StatusCode"] = 1; // bad request id
+    // } else {
+
+    // Typically would call a specific handler from here, but let's just keep parsing.
+    auto it = RequestHandlers_.find(ReqFunc);
+    if (it == RequestHandlers_.end()) {
+        Log_->Log(7, [ReqFunc]() { return "Error, No Handler Exists For Call " + ReqFunc; });
+        ReqResponseJSON["ReqID"] = ReqID;
+        ReqResponseJSON["StatusCode"] = 1; // unknown request *** TODO: use the right code
+        return ReqResponseJSON;
+    }
+    if (!it->second.IsValid()) {
+        ReqResponseJSON["ReqID"] = ReqID;
+        Log_->Log(7, [ReqFunc]() { return "Error, Handler Is Null For Call " + ReqFunc + ", Continuing Anyway"; });
+        // ReqResponseJSON["StatusCode"] = 1; // not a valid EVM request *** TODO: use the right code
+        return ReqResponseJSON;
+    }
+
+    Log_->Log(0, [ReqFunc]() { return "DEBUG -> Got Request For '" + ReqFunc + "'"; });
+    const RouteAndHandler& Handler = it->second;
+    Util::ArenaJSON OverrideParams;
+    if (_SimulationIDOverride != -1) {
+        // Only copy the parameters if we actually have to modify them
+        OverrideParams = *ReqParams;
+        OverrideParams["SimulationID"] = _SimulationIDOverride;
+        ReqParams = &OverrideParams;
+    }
+
+    if (ClientToken.empty()) {
+        ReqResponseJSON = EVMCallHandler(Handler, *ReqParams);
+    } else {
+        // Retried requests get the response of the first attempt (or wait for it if it is still running)
+        std::string CacheKey = ReqFunc + "|" + ClientToken;
+        ReqResponseJSON = RequestCache_->GetOrCompute(CacheKey, [this, &Handler, ReqParams]() { return EVMCallHandler(Handler, *ReqParams); });
+        if (ReqResponseJSON.is_object() && ReqResponseJSON.value("StatusCode", 0) == int(BGStatusCode::BGStatusRouteBusy)) {
+            RequestCache_->Forget(CacheKey); // The request never ran, so a retry has to be able to run it
+        }
+    }
+    ReqResponseJSON["ReqID"] = ReqID;
+
+    // }
+    return ReqResponseJSON;
+}
+
+
+nlohmann::json RPCManager::EVMHandleBatchParallel(const Util::ArenaJSON& _Requests, int _SimulationIDOverride) {
+
+    size_t NumRequests = _Requests.size();
+    nlohmann::json ResponseJSON = nlohmann::json::array();
+    nlohmann::json::array_t& Responses = ResponseJSON.get_ref<nlohmann::json::array_t&>();
+    Responses.resize(NumRequests);
+
+    // Sort the requests into stages, a request is placed one stage after the latest request it depends on.
+    // Since dependencies can only point to earlier requests, a single pass is enough.
+    std::map<int, size_t> StageOfReqID;
+    std::vector<std::vector<size_t>> Stages;
+    std::vector<int> ReqIDs(NumRequests, -1);
+    for (size_t i = 0; i < NumRequests; i++) {
+        const Util::ArenaJSON& Request = _Requests[i];
 
         int ReqID = -1;
-        //int SimulationID = -1;
-        std::string ReqFunc;
-        nlohmann::json ReqParams;
-        nlohmann::json ReqResponseJSON;
-        //std::string Response;
-
-        // Get the mandatory components of a request:
-        for (const auto& [req_key, req_value]: req.items()) {
-            if (req_key == "ReqID") {
-                ReqID = req_value.template get<int>();
-            //} else if (req_key == "SimID") {
-            //    SimulationID = req_value.template get<int>();
-            } else {
-                ReqFunc = req_key;
-                ReqParams = req_value;
+        size_t Stage = 0;
+        bool DependenciesValid = true;
+        if (Request.is_object()) {
+            auto ReqIDIt = Request.find("ReqID");
+            if (ReqIDIt != Request.end() && ReqIDIt->is_number_integer()) {
+                ReqID = ReqIDIt->template get<int>();
+
+                // Responses and dependencies are matched by ReqID, so it has to be unique within the batch
+                if (StageOfReqID.count(ReqID) > 0) {
+                    Log_->Log(7, [ReqID]() { return "Error, ReqID " + std::to_string(ReqID) + " Is Used More Than Once In The Batch"; });
+                    Responses[i]["ReqID"] = ReqID;
+                    Responses[i]["StatusCode"] = int(BGStatusCode::BGStatusInvalidParametersPassed);
+                    continue;
+                }
             }
-        }
-        // if (BadReqID(ReqID)) { // e.g. < highest request ID already handled
-        //     ReqResponseJSON["ReqID"] = ReqID;
-        //     ReqResponseJSON["StatusCode"] = 1; // bad request id
-        // } else {
-
-        // Typically would call a specific handler from here, but let's just keep parsing.
-        auto it = RequestHandlers_.find(ReqFunc);
-        if (it == RequestHandlers_.end()) {
-            Logger_->Log("Error, No Handler Exists For Call " + ReqFunc, 7);
-            ReqResponseJSON["ReqID"] = ReqID;
-            ReqResponseJSON["StatusCode"] = 1; // unknown request *** TODO: use the right code
-            //Response = ReqResponseJSON.dump();
-        } else {
-            if (!it->second) {
-                ReqResponseJSON["ReqID"] = ReqID;
-                Logger_->Log("Error, Handler Is Null For Call " + ReqFunc + ", Continuing Anyway", 7);
-                // ReqResponseJSON["StatusCode"] = 1; // not a valid EVM request *** TODO: use the right code
-            } else {
-                Logger_->Log("DEBUG -> Got Request For '" + ReqFunc + "'", 0);
-                if (_SimulationIDOverride != -1) {
-                    ReqParams["SimulationID"] = _SimulationIDOverride;
+            auto DependsOnIt = Request.find("DependsOn");
+            if (DependsOnIt != Request.end()) {
+                DependenciesValid = DependsOnIt->is_array();
+                for (const auto& Dependency : *DependsOnIt) {
+                    if (!Dependency.is_number_integer()) {
+                        DependenciesValid = false;
+                        break;
+                    }
+                    auto StageIt = StageOfReqID.find(Dependency.template get<int>());
+                    if (StageIt == StageOfReqID.end()) {
+                        DependenciesValid = false;
+                        break;
+                    }
+                    Stage = std::max(Stage, StageIt->second + 1);
                 }
-                std::string Response = it->second(ReqParams.dump()); // Calls the handler.
-                // *** TODO: Either:
-                //     a) Convert handlers to return nlohmann::json objects so that we
-                //        can easily add ReqResponseJSON["ReqID"] = ReqID here, or,
-                //     b) Convert Response back to a ReqResponseJSON here in order to
-                //        add that... (This is more work, lower performance...)
-                //     Right now, we do b) (sadly...)
-                ReqResponseJSON = nlohmann::json::parse(Response);
-                ReqResponseJSON["ReqID"] = ReqID;
             }
         }
 
-        // }
-        ResponseJSON.push_back(ReqResponseJSON);
+        if (!DependenciesValid) {
+            Log_->Log(7, [ReqID]() { return "Error, Request " + std::to_string(ReqID) + " Depends On An Unknown Or Later ReqID"; });
+            Responses[i]["ReqID"] = ReqID;
+            Responses[i]["StatusCode"] = int(BGStatusCode::BGStatusInvalidParametersPassed);
+            continue;
+        }
 
+        ReqIDs[i] = ReqID;
+        if (ReqID != -1) {
+            StageOfReqID[ReqID] = Stage;
+        }
+        if (Stages.size() <= Stage) {
+            Stages.resize(Stage + 1);
+        }
+        Stages[Stage].push_back(i);
     }
 
-    std::string Response = ResponseJSON.dump();
-    if (Response.length() < 1024) { 
-        Logger_->Log("DEBUG --> Responding: " + Response, 0); // For DEBUG
-    } else {
-        Logger_->Log("DEBUG --> Response Omitted Due To Length", 0); // For DEBUG
+    // A failing item only fails its own response, the rest of the batch still runs
+    auto RunItem = [this, &_Requests, &Responses, &ReqIDs, _SimulationIDOverride](size_t _Index) {
+        std::string Error;
+        try {
+            Responses[_Index] = EVMHandleItem(_Requests[_Index], _SimulationIDOverride);
+            return;
+        } catch (std::exception& e) {
+            Error = e.what();
+        } catch (...) {
+            Error = "Unknown Exception";
+        }
+        int ReqID = ReqIDs[_Index];
+        Log_->Log(7, [ReqID, Error]() { return "Error, Request " + std::to_string(ReqID) + " Failed: " + Error; });
+        nlohmann::json ErrorJSON;
+        ErrorJSON["ReqID"] = ReqID;
+        ErrorJSON["StatusCode"] = int(BGStatusCode::BGStatusGeneralFailure);
+        Responses[_Index] = std::move(ErrorJSON);
+    };
+
+    // Run the stages in order, everything within a stage is independent.
+    for (const std::vector<size_t>& Stage : Stages) {
+
+        // No point in handing a single request over to another thread
+        if (Stage.size() == 1) {
+            RunItem(Stage[0]);
+            continue;
+        }
+
+        std::vector<std::future<void>> Pending;
+        Pending.reserve(Stage.size());
+        for (size_t Index : Stage) {
+            // Heavy items go straight to the compute pool, rather than parking a batch worker while they run there
+            Util::ThreadPool* Pool = IsHeavyItem(_Requests[Index]) ? ComputePool_.get() : BatchPool_.get();
+            Pending.push_back(Pool->Enqueue([&RunItem, Index]() { RunItem(Index); }));
+        }
+
+        // Wait for all of them before get() can rethrow, the tasks reference our locals
+        for (std::future<void>& Task : Pending) {
+            Task.wait();
+        }
+        for (std::future<void>& Task : Pending) {
+            Task.get();
+        }
     }
-    // if (!IsLoadingSim()) {
-    //     std::cout << "DEBUG ---> Responding: " << ResponseJSON.dump() << '\n'; std::cout.flush();
-    // }
 
-    return Handle.ResponseAndStoreRequest(ResponseJSON, false); // See comments at ResponseAndStoreRequest().
+    return ResponseJSON;
 }
 
 
+nlohmann::json RPCManager::EVMCallHandler(const RouteAndHandler& _Handler, const Util::ArenaJSON& _Params) {
+
+    AdmissionTicket Ticket(*Admission_, _Handler.Route_);
+    if (!Ticket.IsAdmitted()) {
+        std::string Route = _Handler.Route_;
+        Log_->Log(6, [Route]() { return "Request For '" + Route + "' Rejected, Route Is Saturated"; });
+        nlohmann::json ResponseJSON;
+        ResponseJSON["StatusCode"] = int(BGStatusCode::BGStatusRouteBusy);
+        return ResponseJSON;
+    }
+
+    return _Handler.Call(_Params); // Calls the handler.
+}
+
+
+bool RPCManager::IsHeavyItem(const Util::ArenaJSON& _Request) const {
+    if (!_Request.is_object()) {
+        return false;
+    }
+    for (const auto& [req_key, req_value]: _Request.items()) {
+        if (req_key == "ReqID" || req_key == "DependsOn" || req_key == "ClientToken") {
+            continue;
+        }
+        auto it = RequestHandlers_.find(req_key);
+        return (it != RequestHandlers_.end()) && (it->second.Weight_ == ROUTE_HEAVY);
+    }
+    return false;
+}
+
 
 std::string RPCManager::DoubleEcho(std::string _Request) {
-    Logger_->Log("Echoing '" + _Request + "' To NES", 1);
+    Log_->Log(1, [_Request]() { return "Echoing '" + _Request + "' To NES"; });
 
 
     std::string EchoRequest = "[{\"ReqID\":0,\"Echo\":" + _Request + "}]";
@@ -208,11 +540,11 @@ std::string RPCManager::DoubleEcho(std::string _Request) {
     // Response = "{" + Response + "}";
 
     if (!Status) {
-        Logger_->Log("Error During Query To NES", 7);
+        Log_->Log(7, "Error During Query To NES");
         return "{\"StatusCode\":9999}";
     }
 
-    Logger_->Log("Got Back Echo Reply '" + Response + "'", 1);
+    Log_->Log(1, [Response]() { return "Got Back Echo Reply '" + Response + "'"; });
     return nlohmann::json::parse(Response)[0].dump();
 }
 
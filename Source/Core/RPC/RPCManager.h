@@ -13,6 +13,8 @@
 // Standard Libraries (BG convention: use <> instead of "")
 #include <iostream>
 #include <memory>
+#include <vector>
+#include <cstdint>
 
 // Third-Party Libraries (BG convention: use <> instead of "")
 #include <rpc/server.h>
@@ -22,13 +24,23 @@
 // Internal Libraries (BG convention: use <> instead of "")
 #include <RPC/StaticRoutes.h>
 #include <RPC/RouteAndHandler.h>
+#include <RPC/AdmissionControl.h>
+#include <RPC/RequestCache.h>
+#include <RPC/EventPublisher.h>
+#include <RPC/ParamSchema.h>
+#include <RPC/APIStatusCode.h>
 
 #include <BG/Common/Logger/Logger.h>
 
 #include <RPC/SafeClient.h>
 
+#include <NESInteraction/NESRouter.h>
+
 #include <Config/Config.h>
 
+#include <Util/ThreadPool.h>
+#include <Util/LazyLogger.h>
+
 
 
 namespace BG {
@@ -40,19 +52,31 @@ namespace API {
  *
  * The RPCManager class owns the RPC server and handles its initialization and destruction at the end of the program's run.
  * It also takes a copy of the systemwide configuration struct to configure the RPC server (e.g., host and port).
+ * Routes are registered between construction and Start(), the route table is not locked once the server runs.
  */
 class RPCManager {
 
 private:
 
     Config::Config* Config_; /**Pointer to configuration struct owned by rest of system*/
-    std::unique_ptr<rpc::server> RPCServer_; /**Instance of RPC Server from rpclib*/
     BG::Common::Logger::LoggingSystem* Logger_ = nullptr; /**Pointer to the instance of the logging system*/
+    std::unique_ptr<Util::LazyLogger> Log_; /**Level-gated, asynchronous front of Logger_, used on the request paths (declared first so it outlives the server threads)*/
+    std::unique_ptr<rpc::server> RPCServer_; /**Instance of RPC Server from rpclib*/
 
     std::unique_ptr<SafeClient> APIClient_; /**Instance of the smartclient, allows us to talk back to the API's RPC server */
+    std::unique_ptr<EventPublisher> Events_; /**Pushes job events through APIClient_, declared after it so it is stopped first*/
+    std::unique_ptr<NESRouter> NESRouter_; /**Places simulations on the configured NES backends (or on APIClient_)*/
+
+    std::unique_ptr<Util::ThreadPool> BatchPool_; /**Workers used to run independent items of parallel EVM requests*/
+    std::unique_ptr<Util::ThreadPool> ComputePool_; /**Workers for background jobs and heavy items of parallel batches, its size also caps concurrent heavy calls*/
 
+    std::unique_ptr<AdmissionController> Admission_; /**Bounds concurrent and queued calls per route*/
+    std::unique_ptr<RequestCache> RequestCache_; /**Responses of requests with a ClientToken, so that retries are not run twice*/
 
-    std::map<std::string, std::function<std::string(std::string _JSONRequest)>> RequestHandlers_;
+    bool Started_ = false; /**Set by Start(), routes cannot be added after that*/
+
+
+    std::map<std::string, RouteAndHandler> RequestHandlers_; /**Map of route names to handlers callable from within EVM requests*/
 
 
    /**
@@ -63,6 +87,52 @@ private:
      */
     void AddRequestHandler(std::string _RouteName, RouteAndHandler _Handler);
 
+    /**
+     * @brief Runs a single item of an EVM request array and returns its response (with the ReqID set).
+     * 
+     * @param _Request One element of the EVM request array.
+     * @param _SimulationIDOverride If not -1, replaces the SimulationID parameter of the request.
+     * @return nlohmann::json 
+     */
+    nlohmann::json EVMHandleItem(const Util::ArenaJSON& _Request, int _SimulationIDOverride);
+
+    /**
+     * @brief Runs the handler on the calling thread once admitted.
+     * Answers with BGStatusRouteBusy if the route is saturated.
+     * 
+     * @param _Handler 
+     * @param _Params Parameters of the request.
+     * @return nlohmann::json Response of the handler (without ReqID).
+     */
+    nlohmann::json EVMCallHandler(const RouteAndHandler& _Handler, const Util::ArenaJSON& _Params);
+
+    /**
+     * @brief Returns true if the given EVM request item calls a route registered as ROUTE_HEAVY.
+     */
+    bool IsHeavyItem(const Util::ArenaJSON& _Request) const;
+
+    /**
+     * @brief Runs the items of an EVM request array on the batch worker pool.
+     * Items may list the ReqIDs of earlier items in "DependsOn", they are then only started once those have finished.
+     * Everything else is treated as independent. The responses keep the order of the requests.
+     * An item that throws, or repeats a ReqID already used in the batch, gets an error StatusCode in its own response only.
+     * 
+     * @param _Requests The EVM request array.
+     * @param _SimulationIDOverride If not -1, replaces the SimulationID parameter of each request.
+     * @return nlohmann::json Array of responses.
+     */
+    nlohmann::json EVMHandleBatchParallel(const Util::ArenaJSON& _Requests, int _SimulationIDOverride);
+
+    /**
+     * @brief Runs all items of an already parsed EVM request array, shared by the JSON and binary EVM routes.
+     * 
+     * @param _Requests The EVM request array.
+     * @param _SimulationIDOverride If not -1, replaces the SimulationID parameter of each request.
+     * @param _Parallel If true, independent items are run concurrently (see EVMHandleBatchParallel()).
+     * @return nlohmann::json Array of responses.
+     */
+    nlohmann::json EVMHandleBatch(const Util::ArenaJSON& _Requests, int _SimulationIDOverride, bool _Parallel);
+
     /**
      * @brief Simple echo tool that will make NES echo back the request, then return it to the user.
      * 
@@ -90,16 +160,69 @@ public:
      */
     ~RPCManager();
 
+    /**
+     * @brief Starts the RPC server threads.
+     * Must be called once, after every route was added, since RequestHandlers_ is read without locking.
+     */
+    void Start();
 
 
  
     /**
      * @brief Adds a route to the EVM RPC Handler.
      * 
+     * Heavy routes are admitted at most as often at once as the compute pool has workers.
+     * 
+     * @param _RouteHandle 
+     * @param _Function 
+     * @param _Weight ROUTE_LIGHT for quick calls, ROUTE_HEAVY for long-running work.
+     */
+    void AddRoute(std::string _RouteHandle, std::function<std::string(std::string _JSONRequest)> _Function, RouteWeight _Weight = ROUTE_LIGHT);
+
+    /**
+     * @brief Adds a JSON-native route to the EVM RPC Handler.
+     * The handler gets the parsed request parameters and returns the response object directly,
+     * so no serialization takes place between EVMRequest and the handler.
+     * 
      * @param _RouteHandle 
      * @param _Function 
+     * @param _Weight ROUTE_LIGHT for quick calls, ROUTE_HEAVY for long-running work.
+     */
+    void AddJSONRoute(std::string _RouteHandle, JSONHandler_t _Function, RouteWeight _Weight = ROUTE_LIGHT);
+
+    /**
+     * @brief Adds a JSON-native route whose parameters are described by a schema.
+     * The request is decoded into a P in one pass before the handler is called. Invalid requests
+     * are answered with BGStatusInvalidParametersPassed and a "ParamErrors" list, without calling the handler.
+     * 
+     * @param _RouteHandle 
+     * @param _Schema Parameter schema, built once at registration.
+     * @param _Function Handler taking the decoded parameters.
+     * @param _Weight ROUTE_LIGHT for quick calls, ROUTE_HEAVY for long-running work.
+     */
+    template <typename P> void AddSchemaRoute(std::string _RouteHandle, ParamSchema<P> _Schema, std::function<nlohmann::json(P& _Params)> _Function, RouteWeight _Weight = ROUTE_LIGHT) {
+        AddJSONRoute(_RouteHandle, [Schema = std::move(_Schema), _Function](const Util::ArenaJSON& _Request) {
+            P Params;
+            nlohmann::json Errors = nlohmann::json::array();
+            if (!Schema.Decode(_Request, Params, Errors)) {
+                nlohmann::json ResponseJSON;
+                ResponseJSON["StatusCode"] = int(BGStatusCode::BGStatusInvalidParametersPassed);
+                ResponseJSON["ParamErrors"] = std::move(Errors);
+                return ResponseJSON;
+            }
+            return _Function(Params);
+        }, _Weight);
+    }
+
+    /**
+     * @brief Sets the admission limits of the given route, overriding the configured defaults.
+     * Calls beyond these limits are answered right away with BGStatusRouteBusy.
+     * 
+     * @param _RouteHandle 
+     * @param _MaxConcurrent Maximum number of calls running at once (0 = unlimited).
+     * @param _MaxQueued Maximum number of calls waiting for a free slot.
      */
-    void AddRoute(std::string _RouteHandle, std::function<std::string(std::string _JSONRequest)> _Function);
+    void SetRouteLimits(std::string _RouteHandle, int _MaxConcurrent, int _MaxQueued);
 
     
     /**
@@ -107,22 +230,66 @@ public:
     */
     std::string SetupCallback(std::string _RouteHandle);
 
+    /**
+     * @brief Called by NES when a process (e.g. a simulation load) finished, wakes the loads waiting for it.
+     * Waiters re-query the status of their backend, the request's optional "Backend" ("host:port" as in
+     * NES_Backends) only tells which backend calls back. Served as "NESCompleted".
+     */
+    std::string NESCompleted(std::string _JSONRequest);
 
-    std::string EVMRequest(std::string _JSONRequest, int _SimulationIDOverride = -1); // Generic JSON-based EVM requests.
+    /**
+     * @brief Returns the system configuration the manager was created with.
+     */
+    Config::Config* GetConfig();
+
+    /**
+     * @brief Returns the client connected back to the API service, through which NES is queried.
+     */
+    SafeClient* GetAPIClient();
+
+    /**
+     * @brief Returns the router that decides which NES backend each simulation is loaded on.
+     */
+    NESRouter* GetNESRouter();
+
+    /**
+     * @brief Returns the publisher used to push job progress and completion events to the API service.
+     * Events are only sent once the API service has registered its callback (see SetupCallback()).
+     */
+    EventPublisher* GetEventPublisher();
+
+    /**
+     * @brief Runs the given task on the compute pool without waiting for it, e.g. for jobs that report back through events.
+     * 
+     * @param _Task 
+     */
+    void SubmitBackground(std::function<void()> _Task);
+
+
+    std::string EVMRequest(std::string _JSONRequest, int _SimulationIDOverride = -1, bool _Parallel = false); // Generic JSON-based EVM requests.
+
+    /**
+     * @brief Binary equivalent of EVMRequest(), the request and response arrays are MessagePack encoded.
+     * Avoids text-encoding large numeric arrays, rpclib passes the bytes through as a msgpack bin object.
+     * 
+     * @param _MsgPackRequest MessagePack encoded EVM request array.
+     * @param _Parallel If true, independent items are run concurrently.
+     * @return std::vector<std::uint8_t> MessagePack encoded response array.
+     */
+    std::vector<std::uint8_t> EVMBinaryRequest(const std::vector<std::uint8_t>& _MsgPackRequest, bool _Parallel = false);
 
 
     /**
      * @brief Registers a callback to the API service.
      *
      * Registers a callback function for a specific route. Assumes the callback function may be accessed from any thread.
+     * Unlike AddRoute(), the callback is bound to the RPC server directly and skips the EVM request handling.
      *
      * @param _RouteName Name of the route to register.
-     * @param _Logger Pointer to the logging system instance.
      * @param _CallbackFunction Callback function to be registered.
      */
-    template <typename F> void AddRoute(std::string _RouteName, BG::Common::Logger::LoggingSystem* _Logger, F _CallbackFunction) {
-        std::string LogMsg = "Registering Callback For Route " + _RouteName;
-        _Logger->Log(LogMsg, 0);
+    template <typename F> void BindRoute(std::string _RouteName, F _CallbackFunction) {
+        Log_->Log(0, [_RouteName]() { return "Registering Callback For Route " + _RouteName; });
         RPCServer_->bind(_RouteName.c_str(), _CallbackFunction);
     }
 
@@ -0,0 +1,93 @@
+//=================================//
+// This file is part of BrainGenix //
+//=================================//
+
+
+// Standard Libraries (BG convention: use <> instead of "")
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+
+// Internal Libraries (BG convention: use <> instead of "")
+
+#include <RPC/RequestCache.h>
+
+
+
+namespace BG {
+namespace EVM {
+namespace API {
+
+
+RequestCache::RequestCache(size_t _MaxEntries, int _TTL_ms) {
+    MaxEntries_ = _MaxEntries;
+    TTL_ = std::chrono::milliseconds(_TTL_ms);
+}
+
+void RequestCache::Expire() {
+    std::chrono::steady_clock::time_point Now = std::chrono::steady_clock::now();
+    while (!Order_.empty()) {
+        auto it = Entries_.find(Order_.front());
+        if (Entries_.size() <= MaxEntries_ && Now - it->second.Created <= TTL_) {
+            break;
+        }
+        Entries_.erase(it);
+        Order_.pop_front();
+    }
+}
+
+nlohmann::json RequestCache::GetOrCompute(const std::string& _Key, const std::function<nlohmann::json()>& _Compute) {
+
+    std::promise<nlohmann::json> Promise;
+    std::unique_lock<std::mutex> Lock(Mutex_);
+    Expire();
+
+    auto it = Entries_.find(_Key);
+    if (it != Entries_.end()) {
+        std::shared_future<nlohmann::json> Response = it->second.Response;
+        Lock.unlock();
+        return Response.get(); // Waits if the first request is still running
+    }
+
+    Entry& NewEntry = Entries_[_Key];
+    NewEntry.Response = Promise.get_future().share();
+    NewEntry.Created = std::chrono::steady_clock::now();
+    NewEntry.OrderPosition = Order_.insert(Order_.end(), _Key);
+    NewEntry.Generation = NextGeneration_++;
+    std::uint64_t Generation = NewEntry.Generation;
+    Lock.unlock();
+
+    try {
+        nlohmann::json Result = _Compute();
+        Promise.set_value(Result);
+        return Result;
+    } catch (...) {
+        // Waiting retries see the same exception, later retries run the request again.
+        // The entry may already have been forgotten and replaced by another request's, which is kept.
+        Promise.set_exception(std::current_exception());
+        Forget(_Key, Generation);
+        throw;
+    }
+}
+
+void RequestCache::Forget(const std::string& _Key) {
+    std::lock_guard<std::mutex> Lock(Mutex_);
+    auto it = Entries_.find(_Key);
+    if (it != Entries_.end()) {
+        Order_.erase(it->second.OrderPosition);
+        Entries_.erase(it);
+    }
+}
+
+void RequestCache::Forget(const std::string& _Key, std::uint64_t _Generation) {
+    std::lock_guard<std::mutex> Lock(Mutex_);
+    auto it = Entries_.find(_Key);
+    if (it != Entries_.end() && it->second.Generation == _Generation) {
+        Order_.erase(it->second.OrderPosition);
+        Entries_.erase(it);
+    }
+}
+
+
+}; // Close Namespace API
+}; // Close Namespace EVM
+}; // Close Namespace BG
@@ -0,0 +1,101 @@
+//=================================================================//
+// This file is part of the BrainGenix-EVM Neuron Emulation System //
+//=================================================================//
+
+/*
+    Description: This file provides deduplication of retried requests.
+    Additional Notes: None
+    Date Created: 2024-05-13
+*/
+
+#pragma once
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+#include <nlohmann/json.hpp>
+
+// Internal Libraries (BG convention: use <> instead of "")
+
+
+
+namespace BG {
+namespace EVM {
+namespace API {
+
+
+/**
+ * @brief Remembers the responses of requests that carry a client token, so that retries are not run twice.
+ *
+ * The first request with a given key runs its computation, a retry with the same key either gets the
+ * stored response or, if the first one is still running, waits for it and shares its response.
+ * Entries expire after the time to live, and only the most recent MaxEntries are kept.
+ */
+class RequestCache {
+
+private:
+
+    struct Entry {
+        std::shared_future<nlohmann::json> Response; /**Response of the request, may still be in flight*/
+        std::chrono::steady_clock::time_point Created;
+        std::list<std::string>::iterator OrderPosition; /**Position of the key in Order_, removed together with the entry*/
+        std::uint64_t Generation; /**Tells this entry apart from later ones stored under the same key*/
+    };
+
+    std::map<std::string, Entry> Entries_; /**Cached responses by key*/
+    std::list<std::string> Order_; /**Keys of Entries_ in insertion order, used for expiry and the size bound*/
+    std::mutex Mutex_; /**Protects Entries_, Order_ and NextGeneration_*/
+    std::uint64_t NextGeneration_ = 0; /**Generation given to the next new entry*/
+
+    size_t MaxEntries_; /**Maximum number of remembered requests*/
+    std::chrono::milliseconds TTL_; /**Time after which a response is forgotten*/
+
+
+    /**
+     * @brief Drops expired entries and enforces the size bound. Mutex_ must be held by the caller.
+     */
+    void Expire();
+
+    /**
+     * @brief Forgets the key only if its entry is still the one of the given generation.
+     */
+    void Forget(const std::string& _Key, std::uint64_t _Generation);
+
+public:
+
+    /**
+     * @brief Construct a new RequestCache object
+     *
+     * @param _MaxEntries Maximum number of remembered requests.
+     * @param _TTL_ms Time after which a response is forgotten.
+     */
+    RequestCache(size_t _MaxEntries, int _TTL_ms);
+
+    /**
+     * @brief Returns the response remembered for the given key, or runs _Compute to get it.
+     *
+     * @param _Key Identifies the request, e.g. route and client token.
+     * @param _Compute Called only if the key is unknown, its result is remembered.
+     * @return nlohmann::json Response of the request.
+     */
+    nlohmann::json GetOrCompute(const std::string& _Key, const std::function<nlohmann::json()>& _Compute);
+
+    /**
+     * @brief Forgets the given key, e.g. when its response must not be replayed (such as a busy status).
+     */
+    void Forget(const std::string& _Key);
+
+};
+
+
+}; // Close Namespace API
+}; // Close Namespace EVM
+}; // Close Namespace BG
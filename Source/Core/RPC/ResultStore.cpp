@@ -0,0 +1,91 @@
+//=================================//
+// This file is part of BrainGenix //
+//=================================//
+
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <algorithm>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+
+// Internal Libraries (BG convention: use <> instead of "")
+
+#include <RPC/ResultStore.h>
+#include <RPC/APIStatusCode.h>
+
+
+
+namespace BG {
+namespace EVM {
+namespace API {
+
+
+ResultStore::ResultStore(int _MaxResults, int _TTL_ms) {
+    MaxResults_ = std::max(1, _MaxResults);
+    TTL_ = std::chrono::milliseconds(_TTL_ms);
+}
+
+void ResultStore::Expire() {
+    std::chrono::steady_clock::time_point Now = std::chrono::steady_clock::now();
+    for (auto it = Results_.begin(); it != Results_.end();) {
+        if (Now - it->second.LastAccess > TTL_) {
+            it = Results_.erase(it);
+        } else {
+            it++;
+        }
+    }
+}
+
+int ResultStore::Store(nlohmann::json&& _Items) {
+    std::lock_guard<std::mutex> Lock(Mutex_);
+    Expire();
+
+    // Handles are handed out in increasing order, so the first entry is the oldest one
+    while (int(Results_.size()) >= MaxResults_) {
+        Results_.erase(Results_.begin());
+    }
+
+    int Handle = NextHandle_++;
+    StoredResult& Result = Results_[Handle];
+    Result.Items = std::move(_Items);
+    Result.LastAccess = std::chrono::steady_clock::now();
+    return Handle;
+}
+
+nlohmann::json ResultStore::GetPage(int _Handle, int _Cursor, int _PageSize) {
+    nlohmann::json ResponseJSON;
+    ResponseJSON["ResultHandle"] = _Handle;
+
+    std::lock_guard<std::mutex> Lock(Mutex_);
+    Expire();
+
+    auto it = Results_.find(_Handle);
+    if (it == Results_.end() || _Cursor < 0 || _PageSize <= 0 || size_t(_Cursor) > it->second.Items.size()) {
+        ResponseJSON["StatusCode"] = int(BGStatusCode::BGStatusInvalidParametersPassed);
+        return ResponseJSON;
+    }
+
+    const nlohmann::json::array_t& Items = it->second.Items.get_ref<const nlohmann::json::array_t&>();
+    size_t Begin = size_t(_Cursor);
+    size_t End = std::min(Begin + size_t(_PageSize), Items.size());
+
+    ResponseJSON["StatusCode"] = int(BGStatusCode::BGStatusSuccess);
+    ResponseJSON["Cursor"] = _Cursor;
+    ResponseJSON["TotalItems"] = Items.size();
+    ResponseJSON["Items"] = nlohmann::json::array_t(Items.begin() + Begin, Items.begin() + End);
+    ResponseJSON["NextCursor"] = End >= Items.size() ? -1 : int(End);
+
+    // Kept after the last page too, the response may be lost and the page requested again
+    it->second.LastAccess = std::chrono::steady_clock::now();
+    return ResponseJSON;
+}
+
+bool ResultStore::Release(int _Handle) {
+    std::lock_guard<std::mutex> Lock(Mutex_);
+    return Results_.erase(_Handle) > 0;
+}
+
+
+}; // Close Namespace API
+}; // Close Namespace EVM
+}; // Close Namespace BG
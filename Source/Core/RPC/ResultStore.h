@@ -0,0 +1,106 @@
+//=================================================================//
+// This file is part of the BrainGenix-EVM Neuron Emulation System //
+//=================================================================//
+
+/*
+    Description: This file provides server-side storage of large results that are retrieved in pages.
+    Additional Notes: None
+    Date Created: 2024-05-10
+*/
+
+#pragma once
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <chrono>
+#include <map>
+#include <mutex>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+#include <nlohmann/json.hpp>
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <Config/ConfigDefaults.h>
+
+
+
+namespace BG {
+namespace EVM {
+namespace API {
+
+
+/**
+ * @brief Keeps large array results on the server so that they can be read out one page at a time.
+ *
+ * A result is stored once and identified by a handle. Callers then request pages with a cursor
+ * (the index of the first item) and a page size, each response contains the cursor of the next page.
+ * Results stay readable (so a lost page can be requested again) until they are released, or until they
+ * have not been touched for the configured time to live. The number of stored results is bounded, the
+ * oldest one is dropped first.
+ */
+class ResultStore {
+
+private:
+
+    struct StoredResult {
+        nlohmann::json Items; /**Array of result items*/
+        std::chrono::steady_clock::time_point LastAccess; /**Used to expire abandoned results*/
+    };
+
+    std::map<int, StoredResult> Results_; /**Stored results by handle*/
+    std::mutex Mutex_; /**Protects Results_ and NextHandle_*/
+    int NextHandle_ = 0;
+
+    int MaxResults_; /**Maximum number of results kept at once*/
+    std::chrono::milliseconds TTL_; /**Time after the last access at which a result is dropped*/
+
+
+    /**
+     * @brief Drops expired results. Mutex_ must be held by the caller.
+     */
+    void Expire();
+
+public:
+
+    /**
+     * @brief Construct a new ResultStore object
+     *
+     * @param _MaxResults Maximum number of results kept at once.
+     * @param _TTL_ms Time after the last access at which a result is dropped.
+     */
+    ResultStore(int _MaxResults = CONFIG_DEFAULT_RESULT_STORE_MAX_RESULTS, int _TTL_ms = CONFIG_DEFAULT_RESULT_STORE_TTL_MS);
+
+    /**
+     * @brief Stores the given array and returns its handle.
+     *
+     * @param _Items Array of result items, moved into the store.
+     * @return int Handle with which pages can be requested.
+     */
+    int Store(nlohmann::json&& _Items);
+
+    /**
+     * @brief Builds the response for one page of a stored result.
+     *
+     * The response contains "StatusCode", "ResultHandle", "Cursor", "NextCursor" (-1 after the last page),
+     * "TotalItems" and "Items". An unknown handle, a page size below 1 or a cursor below 0 or past
+     * TotalItems gives BGStatusInvalidParametersPassed (a cursor equal to TotalItems gives an empty last page).
+     *
+     * @param _Handle Handle returned by Store().
+     * @param _Cursor Index of the first item of the page.
+     * @param _PageSize Maximum number of items in the page.
+     * @return nlohmann::json Response object.
+     */
+    nlohmann::json GetPage(int _Handle, int _Cursor, int _PageSize);
+
+    /**
+     * @brief Drops the given result, callers release it once they have read all the pages they need.
+     *
+     * @return true if the handle existed.
+     */
+    bool Release(int _Handle);
+
+};
+
+
+}; // Close Namespace API
+}; // Close Namespace EVM
+}; // Close Namespace BG
@@ -4,13 +4,12 @@
 
 
 // Standard Libraries (BG convention: use <> instead of "")
-#include <thread>
 
 // Third-Party Libraries (BG convention: use <> instead of "")
 
 // Internal Libraries (BG convention: use <> instead of "")
 
-#include <RPC/ManagerTaskData.h>
+#include <RPC/RouteAndHandler.h>
 
 
 
@@ -19,7 +18,20 @@ namespace EVM {
 namespace API {
 
 
+bool RouteAndHandler::IsValid() const {
+    return bool(JSONHandler_) || bool(Handler_);
+}
+
+nlohmann::json RouteAndHandler::Call(const Util::ArenaJSON& _Request) const {
+    if (JSONHandler_) {
+        return JSONHandler_(_Request);
+    }
+
+    // Adapter for legacy handlers, this is the slow path (serialize, handle, parse)
+    return nlohmann::json::parse(Handler_(_Request.dump()));
+}
+
 
 }; // Close Namespace API
 }; // Close Namespace EVM
-}; // Close Namespace BG
\ No newline at end of file
+}; // Close Namespace BG
@@ -3,7 +3,7 @@
 //=================================================================//
 
 /*
-    Description: This file provides bgStatusCode.
+    Description: This file provides the route/handler pairs used by the EVM request dispatcher.
     Additional Notes: None
     Date Created: 2024-02-06
 */
@@ -17,10 +17,13 @@
 // #include <map>
 
 // Third-Party Libraries (BG convention: use <> instead of "")
+#include <nlohmann/json.hpp>
 
 // Internal Libraries (BG convention: use <> instead of "")
 #include <RPC/ManagerTaskData.h>
 
+#include <Util/RequestArena.h>
+
 
 namespace BG {
 namespace EVM {
@@ -28,18 +31,56 @@ namespace API {
 
 
 
-// *** NOTE: By passing JSON objects/components as strings and then having to
-//           parse them into JSON objects again, the handlers above are doing
-//           a bunch of unnecessary extra work - you can just pass references
-//           to components of a JSON object as a JSON object.
-//           E.g. call AddBSNeuron(ReqParams) where ReqParams is as obtained
-//           in EVMRequest() below.
+/**
+ * @brief Legacy handler type, takes a serialized JSON request and returns a serialized JSON response.
+ */
+typedef std::function<std::string(std::string _JSONRequest)> StringHandler_t;
+
+/**
+ * @brief JSON-native handler type, takes the already parsed request parameters and returns the response object.
+ * Handlers of this type avoid the dump/parse round trip that EVMRequest otherwise has to do for every sub-request.
+ * The request lives in the caller's arena, so handlers must not keep references to it after returning.
+ */
+typedef std::function<nlohmann::json(const Util::ArenaJSON& _Request)> JSONHandler_t;
+
+
+/**
+ * @brief Cost class of a route, given at registration time.
+ * Both run on the calling thread, but heavy routes may only run as many calls at once as the compute pool
+ * has workers (see RPCManager::AddRequestHandler()). Items of parallel batches that call heavy routes are
+ * run on the compute pool, and asynchronous jobs (RPCManager::SubmitBackground()) run there as well.
+ */
+enum RouteWeight {
+    ROUTE_LIGHT = 0, // Quick calls, e.g. echo, version and status queries.
+    ROUTE_HEAVY = 1  // Long-running work, e.g. validation runs.
+};
 
-// typedef std::string EVMRequest_func_t(const nlohmann::json&);
 
+/**
+ * @brief Pairs a route name with the handler that serves it.
+ *
+ * Exactly one of the two handlers is expected to be set. If the JSON-native handler
+ * is present it is always preferred, otherwise the string handler is adapted.
+ */
 struct RouteAndHandler {
-    std::string Route_;
-    std::function<std::string>& Handler_;
+    std::string Route_;             /**Name of the route, e.g. "Debug/Echo"*/
+    StringHandler_t Handler_;       /**Legacy string-based handler (may be empty)*/
+    JSONHandler_t JSONHandler_;     /**JSON-native handler (may be empty)*/
+    RouteWeight Weight_ = ROUTE_LIGHT; /**Decides which threads run the handler*/
+
+    /**
+     * @brief Returns true if either handler has been set.
+     */
+    bool IsValid() const;
+
+    /**
+     * @brief Calls the handler with the given parameters.
+     * String handlers are adapted by serializing the request and parsing their response.
+     *
+     * @param _Request Parameters of the request.
+     * @return nlohmann::json Response object.
+     */
+    nlohmann::json Call(const Util::ArenaJSON& _Request) const;
 };
 
 
@@ -5,6 +5,8 @@
 
 // Standard Libraries (BG convention: use <> instead of "")
 #include <thread>
+#include <chrono>
+#include <algorithm>
 
 // Third-Party Libraries (BG convention: use <> instead of "")
 #include <rpc/rpc_error.h>
@@ -20,57 +22,47 @@
 
 
 namespace BG {
-namespace EVM {
 
 
-bool SafeClient::RunVersionCheck() {
+bool SafeClient::RunVersionCheck(Connection& _Connection) {
 
-    if (Client_ == nullptr) {
+    if (_Connection.Client_ == nullptr) {
         return false;
     }
 
-    // Run a query to force it to connect (or fail)
-    std::string Temp;
-    MakeJSONQuery("GetAPIVersion", &Temp);
-    
-
-    // Update our internal status of how the connection is doing
-    ::rpc::client::connection_state RPCStatus = Client_->get_connection_state();
-    if (RPCStatus != ::rpc::client::connection_state::connected) {
-        Logger_->Log("Unable to connect to RPC Service", 3);
-        LastState_ = false;
-    } else {
-        if (!LastState_) {
-            Logger_->Log("NES RPC Connection SERVICE_HEALTHY", 1);
-            LastState_ = true;
-        }
-    }
-
-    // Check Version again (used as a heartbeat 'isAlive' check)
+    // Check Version (used as a heartbeat 'isAlive' check), this also forces the client to connect (or fail)
     std::string Version = "undefined";
-    bool Status = MakeJSONQuery("GetAPIVersion", &Version, true);
-    if (!Status) {
+    if (!Call(_Connection, "GetAPIVersion", &Version)) {
         Logger_->Log("Failed To Get RPC Service API Version String", 1);
         return false;
     }
 
     if (Version != VERSION) {
         Logger_->Log("Client/Server Version Mismatch! This might make stuff break. Server " + Version + " Client " + VERSION, 9);
+        _Connection.IsHealthy_ = false;
         return false;
     }
+    _Connection.IsHealthy_ = true;
     return true;
 
-
 }
 
-bool SafeClient::Connect() {
-    IsHealthy_ = false;
-    Client_ = nullptr;
+bool SafeClient::Connect(Connection& _Connection) {
+    _Connection.IsHealthy_ = false;
+    _Connection.HasClient_ = false;
+    _Connection.Client_ = nullptr;
 
     // Extract RPC Service Client Parameters, Connect, Configure
-    std::string NESHost = RPCHost_;
-    int NESPort = RPCPort_;
-    int NESTimeout_ms = RPCTimeout_ms;
+    std::string NESHost;
+    int NESPort;
+    int NESTimeout_ms;
+    {
+        std::lock_guard<std::mutex> Lock(ConfigMutex_);
+        NESHost = RPCHost_;
+        NESPort = RPCPort_;
+        NESTimeout_ms = RPCTimeout_ms;
+    }
+    _Connection.Generation_ = ConnectGeneration_;
     
     Logger_->Log("Connecting to RPC Service on port: " + std::to_string(NESPort), 1);
     Logger_->Log("Connecting to RPC Service on host: " + NESHost, 1);
@@ -78,27 +70,40 @@ bool SafeClient::Connect() {
 
 
     try {
-        Client_ = std::make_unique<::rpc::client>(NESHost.c_str(), NESPort);
+        _Connection.Client_ = std::make_shared<::rpc::client>(NESHost.c_str(), NESPort);
     } catch (std::system_error& e) {
         Logger_->Log("Cannot find RPC Service host (authoritative)", 9);
         return false;
     }
-    Client_->set_timeout(NESTimeout_ms);
+    _Connection.Client_->set_timeout(NESTimeout_ms);
+    _Connection.HasClient_ = true;
 
     // Call GetVersion On Remote - allows us to check that versions match, but also ensures the connection is ready
-    bool Status = RunVersionCheck();
-    if (Status) {
-        IsHealthy_ = true;
-    }
-    return Status;
+    return RunVersionCheck(_Connection);
 
 }
 
 
-SafeClient::SafeClient(BG::Common::Logger::LoggingSystem* _Logger) {
+SafeClient::SafeClient(BG::Common::Logger::LoggingSystem* _Logger, int _PoolSize) {
 
     Logger_ = _Logger;
     RequestExit_ = false;
+    UseSharedMemory_ = false;
+    SingleFlight_ = true;
+    Hedging_ = false;
+    HedgesSent_ = 0;
+    NextSlot_ = 0;
+    Waiters_ = 0;
+    ConnectGeneration_ = 0;
+    IdleProbeInterval_ms_ = 2000;
+    BackoffMin_ms_ = 500;
+    BackoffMax_ms_ = 30000;
+    Random_.seed(std::random_device()());
+
+    for (int i = 0; i < std::max(1, _PoolSize); i++) {
+        Pool_.push_back(std::make_unique<Connection>());
+    }
+
     ClientManager_ = std::thread(&SafeClient::RPCManagerThread, this);
 
 }
@@ -109,86 +114,557 @@ SafeClient::~SafeClient() {
 }
 
 bool SafeClient::SetTimeout(int _Timeout_ms) {
+    std::lock_guard<std::mutex> Lock(ConfigMutex_);
     RPCTimeout_ms = _Timeout_ms;
     return true;
 }
 bool SafeClient::SetHostPort(std::string _Host, int _Port) {
+    std::lock_guard<std::mutex> Lock(ConfigMutex_);
     RPCHost_ = _Host;
     RPCPort_ = _Port;
     return true;
 }
 
+void SafeClient::SetHealthCheckTiming(int _IdleProbeInterval_ms, int _BackoffMin_ms, int _BackoffMax_ms) {
+    IdleProbeInterval_ms_ = std::max(1, _IdleProbeInterval_ms);
+    BackoffMin_ms_ = std::max(1, _BackoffMin_ms);
+    BackoffMax_ms_ = std::max(BackoffMin_ms_.load(), _BackoffMax_ms);
+}
+
 void SafeClient::Reconnect() {
-    IsHealthy_ = false;
+    ConnectGeneration_++;
 }
 
-bool SafeClient::MakeJSONQuery(std::string _Route, std::string* _Result, bool _ForceQuery) {
-    if (!_ForceQuery && !IsHealthy_) {
-        return false;
+void SafeClient::SetSharedMemoryTransport(bool _UseSharedMemory) {
+    UseSharedMemory_ = _UseSharedMemory;
+}
+
+bool SafeClient::UsesSharedMemoryTransport() const {
+    return UseSharedMemory_;
+}
+
+void SafeClient::SetSingleFlight(bool _Enabled) {
+    SingleFlight_ = _Enabled;
+}
+
+void SafeClient::SetHedging(bool _Enabled) {
+    Hedging_ = _Enabled;
+}
+
+std::uint64_t SafeClient::GetHedgeCount() const {
+    return HedgesSent_;
+}
+
+int SafeClient::GetPoolSize() const {
+    return int(Pool_.size());
+}
+
+bool SafeClient::IsHealthy() const {
+    return HasUsableConnection(true);
+}
+
+
+SafeClient::Connection* SafeClient::TryCheckout(bool _RequireHealthy, const Connection* _Exclude) {
+    unsigned int Start = NextSlot_.fetch_add(1, std::memory_order_relaxed);
+    for (size_t i = 0; i < Pool_.size(); i++) {
+        Connection* Candidate = Pool_[(Start + i) % Pool_.size()].get();
+        if (Candidate == _Exclude || Candidate->InUse_.load(std::memory_order_relaxed)) {
+            continue;
+        }
+        if (_RequireHealthy && !Candidate->IsHealthy_.load(std::memory_order_relaxed)) {
+            continue;
+        }
+        bool Expected = false;
+        if (!Candidate->InUse_.compare_exchange_strong(Expected, true, std::memory_order_acquire)) {
+            continue;
+        }
+
+        // Connections made for an old target are left to the manager thread to remake
+        if (Candidate->Generation_ != ConnectGeneration_) {
+            Candidate->IsHealthy_ = false;
+        }
+
+        // Health may have changed between the check and the claim, and forced queries still need a client.
+        // Released without Return(): this runs inside Checkout()'s wait predicate with ReturnMutex_ held,
+        // and nobody is waiting for a connection that cannot be used anyway.
+        if ((_RequireHealthy && !Candidate->IsHealthy_) || Candidate->Client_ == nullptr) {
+            Candidate->InUse_.store(false, std::memory_order_release);
+            continue;
+        }
+        return Candidate;
+    }
+    return nullptr;
+}
+
+bool SafeClient::HasUsableConnection(bool _RequireHealthy) const {
+    for (const std::unique_ptr<Connection>& Candidate : Pool_) {
+        if (_RequireHealthy ? Candidate->IsHealthy_.load() : Candidate->HasClient_.load()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+SafeClient::Connection* SafeClient::Checkout(bool _RequireHealthy, int _MaxWait_ms) {
+
+    Connection* Claimed = TryCheckout(_RequireHealthy);
+    if (Claimed != nullptr || !HasUsableConnection(_RequireHealthy)) {
+        return Claimed;
     }
+
+    // Everything usable is busy, wait for a return
+    int Timeout_ms;
+    {
+        std::lock_guard<std::mutex> Lock(ConfigMutex_);
+        Timeout_ms = RPCTimeout_ms > 0 ? RPCTimeout_ms : 1000;
+    }
+    if (_MaxWait_ms > 0) {
+        Timeout_ms = std::min(Timeout_ms, _MaxWait_ms);
+    }
+    std::chrono::steady_clock::time_point Deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(Timeout_ms);
+
+    Waiters_++;
+    {
+        std::unique_lock<std::mutex> Lock(ReturnMutex_);
+        ReturnCondition_.wait_until(Lock, Deadline, [&]() {
+            Claimed = TryCheckout(_RequireHealthy);
+            return Claimed != nullptr || !HasUsableConnection(_RequireHealthy) || RequestExit_;
+        });
+    }
+    Waiters_--;
+
+    if (Claimed == nullptr) {
+        Logger_->Log("No Free RPC Connection Within Timeout, All " + std::to_string(Pool_.size()) + " Connections Busy", 3);
+    }
+    return Claimed;
+}
+
+void SafeClient::Return(Connection* _Connection) {
+    _Connection->InUse_.store(false, std::memory_order_release);
+    if (Waiters_.load() > 0) {
+        { std::lock_guard<std::mutex> Lock(ReturnMutex_); }
+        ReturnCondition_.notify_all();
+    }
+}
+
+
+void SafeClient::MarkSuccess(Connection& _Connection) {
+    _Connection.LastSuccess_ms_ = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+
+template <typename... Args>
+bool SafeClient::Call(Connection& _Connection, const std::string& _Route, std::string* _Result, Args... _Args) {
     try {
-        (*_Result) = Client_->call(_Route.c_str()).as<std::string>();
+        (*_Result) = _Connection.Client_->call(_Route.c_str(), _Args...).template as<std::string>();
     } catch (::rpc::timeout& e) {
         Logger_->Log("RPC Connection Timed Out", 3);
+        if (_Connection.Client_->get_connection_state() != ::rpc::client::connection_state::connected) {
+            _Connection.IsHealthy_ = false;
+        }
         return false;
     } catch (::rpc::rpc_error& e) {
         Logger_->Log("RPC Remote Returned Error", 3);
         return false;
     } catch (std::system_error& e) {
-        Logger_->Log("Cannot Cannot Talk To RPC Host", 3);
+        Logger_->Log("Cannot Talk To RPC Host", 3);
+        _Connection.IsHealthy_ = false;
         return false;
     }
+    MarkSuccess(_Connection);
     return true;
 }
 
 
-bool SafeClient::MakeJSONQuery(std::string _Route, std::string _Query, std::string* _Result, bool _ForceQuery) {
-    if (!_ForceQuery && !IsHealthy_) {
+bool SafeClient::MakeJSONQuery(std::string _Route, std::string* _Result, bool _ForceQuery) {
+    Lease Conn(this, Checkout(!_ForceQuery));
+    if (!Conn) {
         return false;
     }
-    try {
-        (*_Result) = Client_->call(_Route.c_str(), _Query).as<std::string>();
-    } catch (::rpc::timeout& e) {
-        Logger_->Log("NES Connection timed out!",3);
+    return Call(*Conn, _Route, _Result);
+}
+
+
+bool SafeClient::MakeJSONQuery(std::string _Route, std::string _Query, std::string* _Result, bool _ForceQuery, int _Deadline_ms) {
+
+    // Read-only queries go through the asynchronous path, so identical concurrent ones share a round trip and slow ones can be hedged
+    if ((SingleFlight_ || Hedging_) && !_ForceQuery && IsShareableQuery(_Route, _Query)) {
+        QueryResult Result = MakeJSONQueryAsync(std::move(_Route), std::move(_Query), false, _Deadline_ms).get();
+        (*_Result) = std::move(Result.Response_);
+        return Result.Success_;
+    }
+
+    // The deadline covers the wait for a connection as well as the call itself
+    std::chrono::steady_clock::time_point Deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(_Deadline_ms);
+    Lease Conn(this, Checkout(!_ForceQuery, _Deadline_ms));
+    if (!Conn) {
         return false;
-    } catch (::rpc::rpc_error& e) {
-        Logger_->Log("NES remote returned RPC error",3);
+    }
+    if (_Deadline_ms <= 0) {
+        return Call(*Conn, _Route, _Result, _Query);
+    }
+    int Remaining_ms = int(std::chrono::duration_cast<std::chrono::milliseconds>(Deadline - std::chrono::steady_clock::now()).count());
+    if (Remaining_ms <= 0) {
+        Logger_->Log("RPC Connection Timed Out", 3);
         return false;
-    } catch (std::system_error& e) {
-        Logger_->Log("Cannot talk to RPC Service host",3);
+    }
+
+    // The connection is ours until returned, so its timeout can be narrowed for this call only
+    int Timeout_ms;
+    {
+        std::lock_guard<std::mutex> Lock(ConfigMutex_);
+        Timeout_ms = RPCTimeout_ms;
+    }
+    (*Conn).Client_->set_timeout(Remaining_ms);
+    bool Status = Call(*Conn, _Route, _Result, _Query);
+    if ((*Conn).Client_ != nullptr) {
+        (*Conn).Client_->set_timeout(Timeout_ms);
+    }
+    return Status;
+}
+
+
+bool SafeClient::IsReadOnlyRoute(const std::string& _Route) {
+    if (_Route.empty()) {
+        return false; // Status of whatever the caller just started, an earlier identical query may predate it
+    }
+    size_t NameStart = _Route.rfind('/');
+    NameStart = (NameStart == std::string::npos) ? 0 : NameStart + 1;
+    return _Route.compare(NameStart, 3, "Get") == 0;
+}
+
+
+bool SafeClient::IsShareableQuery(const std::string& _Route, const std::string& _Query) {
+    if (!IsReadOnlyRoute(_Route)) {
         return false;
     }
-    return true;
+
+    // Each shared memory segment in a reply is handed to exactly one reader, who unlinks it
+    size_t Transport = _Query.find("\"BulkTransport\"");
+    return Transport == std::string::npos || _Query.find("\"SHM\"", Transport) == std::string::npos;
+}
+
+
+EVM::Util::LatencyTracker* SafeClient::GetRouteLatency(const std::string& _Route) {
+    std::lock_guard<std::mutex> Lock(LatencyMutex_);
+    std::unique_ptr<EVM::Util::LatencyTracker>& Tracker = RouteLatency_[_Route];
+    if (!Tracker) {
+        Tracker = std::make_unique<EVM::Util::LatencyTracker>();
+    }
+    return Tracker.get();
+}
+
+
+std::shared_ptr<SafeClient::InFlightQuery> SafeClient::FindInFlight(const std::string& _Key) const {
+    auto Existing = InFlight_.find(_Key);
+    if (Existing == InFlight_.end()
+        || Existing->second->Reply_.wait_for(std::chrono::seconds(0)) == std::future_status::ready
+        || std::chrono::steady_clock::now() >= Existing->second->Deadline_) {
+        return nullptr;
+    }
+    return Existing->second;
+}
+
+
+void SafeClient::SendHedge(const std::shared_ptr<InFlightQuery>& _Query) {
+
+    // Only worth it on a different socket, the original one may be what is stalled
+    Lease Conn(this, TryCheckout(true, _Query->Target_));
+    if (!Conn) {
+        return;
+    }
+    try {
+        _Query->HedgeClient_ = (*Conn).Client_;
+        _Query->HedgeReply_ = _Query->HedgeClient_->async_call(_Query->Route_.c_str(), _Query->Query_).share();
+        _Query->HedgeTarget_ = &(*Conn);
+        HedgesSent_++;
+    } catch (std::system_error& e) {
+        Logger_->Log("Cannot Talk To RPC Host", 3);
+        (*Conn).IsHealthy_ = false;
+    }
+}
+
+
+bool SafeClient::ConvertReply(const std::shared_future<clmdep_msgpack::object_handle>& _Reply, Connection* _Target, QueryResult& _Result) {
+    try {
+        _Result.Response_ = _Reply.get().as<std::string>();
+        _Result.Success_ = true;
+        MarkSuccess(*_Target);
+        return true;
+    } catch (::rpc::rpc_error& e) {
+        Logger_->Log("RPC Remote Returned Error", 3);
+    } catch (std::system_error& e) {
+        Logger_->Log("Cannot Talk To RPC Host", 3);
+        _Target->IsHealthy_ = false;
+    } catch (std::exception& e) {
+        Logger_->Log("RPC Call Failed: " + std::string(e.what()), 3);
+    }
+    return false;
+}
+
+
+std::future<QueryResult> SafeClient::CollectReply(std::shared_ptr<InFlightQuery> _Query, std::chrono::steady_clock::time_point _Deadline) {
+    return std::async(std::launch::deferred, [this, _Query, _Deadline]() {
+        QueryResult Result;
+        std::chrono::steady_clock::time_point Deadline = std::min(_Deadline, _Query->Deadline_);
+
+        // Past the hedge point, send (once for all waiters) a duplicate on another connection
+        bool Hedged = false;
+        if (_Query->HedgeAt_ < Deadline && _Query->Reply_.wait_until(_Query->HedgeAt_) != std::future_status::ready) {
+            std::call_once(_Query->HedgeOnce_, [this, &_Query]() { SendHedge(_Query); });
+            Hedged = _Query->HedgeReply_.valid();
+        }
+
+        if (!Hedged) {
+            if (_Query->Reply_.wait_until(Deadline) != std::future_status::ready) {
+                Logger_->Log("RPC Connection Timed Out", 3);
+                return Result;
+            }
+            if (ConvertReply(_Query->Reply_, _Query->Target_, Result) && !_Query->Recorded_.exchange(true)) {
+                _Query->Latency_->Record(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - _Query->SentAt_).count());
+            }
+            return Result;
+        }
+
+        // Take whichever of the two answers successfully first. rpclib futures cannot be waited on together,
+        // so the waiter takes short turns on each pending one instead of parking a thread per reply.
+        bool PrimaryPending = true;
+        bool HedgePending = true;
+        while (!Result.Success_ && (PrimaryPending || HedgePending)) {
+            std::chrono::steady_clock::time_point Now = std::chrono::steady_clock::now();
+            if (Now >= Deadline) {
+                Logger_->Log("RPC Connection Timed Out", 3);
+                return Result;
+            }
+            std::chrono::steady_clock::time_point TurnEnd = std::min(Deadline, Now + std::chrono::milliseconds(HEDGE_WAIT_TURN_ms));
+            if (PrimaryPending && _Query->Reply_.wait_until(HedgePending ? TurnEnd : Deadline) == std::future_status::ready) {
+                PrimaryPending = false;
+                ConvertReply(_Query->Reply_, _Query->Target_, Result);
+                continue;
+            }
+            TurnEnd = std::min(Deadline, std::chrono::steady_clock::now() + std::chrono::milliseconds(HEDGE_WAIT_TURN_ms));
+            if (HedgePending && _Query->HedgeReply_.wait_until(PrimaryPending ? TurnEnd : Deadline) == std::future_status::ready) {
+                HedgePending = false;
+                ConvertReply(_Query->HedgeReply_, _Query->HedgeTarget_, Result);
+            }
+        }
+        if (Result.Success_ && !_Query->Recorded_.exchange(true)) {
+            _Query->Latency_->Record(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - _Query->SentAt_).count());
+        }
+        return Result;
+    });
+}
+
+
+std::vector<std::future<QueryResult>> SafeClient::MakeJSONQueriesAsync(const std::vector<JSONQuery>& _Queries, bool _ForceQuery) {
+
+    std::vector<std::future<QueryResult>> Futures;
+    Futures.reserve(_Queries.size());
+
+    int Timeout_ms;
+    {
+        std::lock_guard<std::mutex> Lock(ConfigMutex_);
+        Timeout_ms = RPCTimeout_ms > 0 ? RPCTimeout_ms : 1000;
+    }
+
+    // Only hold the connection while the requests are written, the replies are matched by rpclib.
+    // It is only checked out once a query actually has to be sent.
+    std::unique_ptr<Lease> Conn;
+    for (const JSONQuery& Query : _Queries) {
+
+        std::chrono::steady_clock::time_point Deadline = std::chrono::steady_clock::now()
+            + std::chrono::milliseconds(Query.Deadline_ms_ > 0 ? Query.Deadline_ms_ : Timeout_ms);
+        bool ReadOnly = !_ForceQuery && IsShareableQuery(Query.Route_, Query.Query_);
+
+        // Join an identical read-only query that is still waiting for its reply
+        bool Coalesce = SingleFlight_ && ReadOnly;
+        std::string Key;
+        if (Coalesce) {
+            Key.reserve(Query.Route_.size() + Query.Query_.size() + 1);
+            Key.append(Query.Route_).push_back('\0');
+            Key.append(Query.Query_);
+
+            std::lock_guard<std::mutex> Lock(InFlightMutex_);
+            std::shared_ptr<InFlightQuery> Pending = FindInFlight(Key);
+            if (Pending) {
+                Futures.push_back(CollectReply(Pending, Deadline));
+                continue;
+            }
+        }
+
+        if (!Conn) {
+            Conn = std::make_unique<Lease>(this, Checkout(!_ForceQuery, Query.Deadline_ms_));
+        }
+        if (!*Conn) {
+            std::promise<QueryResult> Failed;
+            Failed.set_value(QueryResult());
+            Futures.push_back(Failed.get_future());
+            continue;
+        }
+
+        // Send while holding the table, so a caller racing with this one joins it instead of sending too
+        std::unique_lock<std::mutex> Lock(InFlightMutex_, std::defer_lock);
+        if (Coalesce) {
+            Lock.lock();
+            std::shared_ptr<InFlightQuery> Pending = FindInFlight(Key);
+            if (Pending) {
+                Futures.push_back(CollectReply(Pending, Deadline));
+                continue;
+            }
+        }
+
+        std::shared_ptr<InFlightQuery> Sent = std::make_shared<InFlightQuery>();
+        Sent->Target_ = &(**Conn);
+        Sent->Client_ = Sent->Target_->Client_; // Keeps the client alive even if it is replaced meanwhile
+        Sent->SentAt_ = std::chrono::steady_clock::now();
+        Sent->Deadline_ = Deadline;
+        Sent->HedgeAt_ = std::chrono::steady_clock::time_point::max();
+        Sent->Latency_ = GetRouteLatency(Query.Route_);
+
+        // Slow replies of idempotent routes are hedged once they are slower than nearly all recent ones
+        if (Hedging_ && ReadOnly && Pool_.size() > 1) {
+            double HedgeDelay_ms = Sent->Latency_->Quantile(HEDGE_QUANTILE);
+            if (HedgeDelay_ms >= 0.0) {
+                Sent->HedgeAt_ = Sent->SentAt_ + std::chrono::microseconds(static_cast<std::int64_t>(HedgeDelay_ms * 1000.0) + 1000);
+                Sent->Route_ = Query.Route_;
+                Sent->Query_ = Query.Query_;
+            }
+        }
+
+        try {
+            Sent->Reply_ = Sent->Client_->async_call(Query.Route_.c_str(), Query.Query_).share();
+        } catch (std::system_error& e) {
+            Logger_->Log("Cannot Talk To RPC Host", 3);
+            Sent->Target_->IsHealthy_ = false;
+            std::promise<QueryResult> Failed;
+            Failed.set_value(QueryResult());
+            Futures.push_back(Failed.get_future());
+            continue;
+        }
+
+        if (Coalesce) {
+            // Answered queries are dropped here rather than by their waiters, which may never collect them
+            if (InFlight_.size() >= SINGLE_FLIGHT_SWEEP_SIZE) {
+                for (auto It = InFlight_.begin(); It != InFlight_.end();) {
+                    bool Finished = It->second->Reply_.wait_for(std::chrono::seconds(0)) == std::future_status::ready
+                        || std::chrono::steady_clock::now() >= It->second->Deadline_;
+                    It = Finished ? InFlight_.erase(It) : std::next(It);
+                }
+            }
+            InFlight_[Key] = Sent;
+        }
+        Futures.push_back(CollectReply(Sent, Deadline));
+    }
+    return Futures;
+}
+
+std::future<QueryResult> SafeClient::MakeJSONQueryAsync(std::string _Route, std::string _Query, bool _ForceQuery, int _Deadline_ms) {
+    std::vector<JSONQuery> Queries(1);
+    Queries[0].Route_ = std::move(_Route);
+    Queries[0].Query_ = std::move(_Query);
+    Queries[0].Deadline_ms_ = _Deadline_ms;
+    return std::move(MakeJSONQueriesAsync(Queries, _ForceQuery)[0]);
+}
+
+bool SafeClient::MakeJSONQueries(const std::vector<JSONQuery>& _Queries, std::vector<QueryResult>& _Results, bool _ForceQuery) {
+    std::vector<std::future<QueryResult>> Futures = MakeJSONQueriesAsync(_Queries, _ForceQuery);
+    _Results.clear();
+    _Results.reserve(Futures.size());
+    bool AllSucceeded = true;
+    for (std::future<QueryResult>& Future : Futures) {
+        _Results.push_back(Future.get());
+        AllSucceeded &= _Results.back().Success_;
+    }
+    return AllSucceeded;
+}
+
+
+void SafeClient::MaintainConnection(Connection& _Connection) {
+
+    std::chrono::steady_clock::time_point Now = std::chrono::steady_clock::now();
+
+    // A new target is connected to right away, whatever the backoff says
+    bool IsStale = _Connection.Generation_ != ConnectGeneration_;
+    if (IsStale) {
+        _Connection.ConnectFailures_ = 0;
+        _Connection.NextConnectAttempt_ = Now;
+    }
+
+    if (_Connection.IsHealthy_ && !IsStale) {
+
+        // Successful traffic already proves the link is alive, only probe connections that have been idle
+        std::int64_t Now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(Now.time_since_epoch()).count();
+        if (Now_ms - _Connection.LastSuccess_ms_ < IdleProbeInterval_ms_) {
+            return;
+        }
+        if (RunVersionCheck(_Connection)) {
+            return;
+        }
+        _Connection.NextConnectAttempt_ = Now;
+    }
+
+    if (Now < _Connection.NextConnectAttempt_) {
+        return;
+    }
+
+    if (Connect(_Connection)) {
+        _Connection.ConnectFailures_ = 0;
+        return;
+    }
+
+    // Exponential backoff with jitter, so many EVM instances do not hammer a recovering service in lockstep
+    _Connection.ConnectFailures_++;
+    std::int64_t Delay_ms = BackoffMin_ms_;
+    for (int i = 1; i < _Connection.ConnectFailures_ && Delay_ms < BackoffMax_ms_; i++) {
+        Delay_ms *= 2;
+    }
+    Delay_ms = std::min<std::int64_t>(Delay_ms, BackoffMax_ms_);
+    std::uniform_int_distribution<std::int64_t> Jitter(Delay_ms / 2, Delay_ms);
+    Delay_ms = Jitter(Random_);
+    _Connection.NextConnectAttempt_ = Now + std::chrono::milliseconds(Delay_ms);
+    Logger_->Log("Failed To Reconnect To RPC Service, Retrying In " + std::to_string(Delay_ms) + "ms", 3);
 }
 
 
 void SafeClient::RPCManagerThread() {
 
     // Wait Until Config Valid
-    while (RPCHost_ == "") {
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    while (!RequestExit_) {
+        {
+            std::lock_guard<std::mutex> Lock(ConfigMutex_);
+            if (RPCHost_ != "") {
+                break;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
     }
 
 
-    // Enter loop
+    // Enter loop, each pass is cheap unless a probe or reconnect is due
     while (!RequestExit_) {
 
-        // Check Version
-        bool IsHealthy = RunVersionCheck();
-
-        // If not healthy, re-establish connection, retry stuff... For now, nothing...
-        if (!IsHealthy) {
-            if (!Connect()) {
-                Logger_->Log("Failed To Reconnect To RPC Service (Connect() returned false)", 3);
+        // Check each idle connection, connections in use are checked on a later pass
+        bool AnyHealthy = false;
+        for (std::unique_ptr<Connection>& Slot : Pool_) {
+            bool Expected = false;
+            if (!Slot->InUse_.compare_exchange_strong(Expected, true)) {
+                AnyHealthy |= Slot->IsHealthy_.load();
+                continue;
             }
+            MaintainConnection(*Slot);
+            AnyHealthy |= Slot->IsHealthy_.load();
+            Return(Slot.get());
+        }
+
+        if (AnyHealthy != LastState_) {
+            Logger_->Log(AnyHealthy ? "NES RPC Connection SERVICE_HEALTHY" : "Unable to connect to RPC Service", AnyHealthy ? 1 : 3);
+            LastState_ = AnyHealthy;
         }
 
-        // Wait 1000ms before polling again
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
 
 
     }
 }
 
-}; // Close Namespace EVM
-}; // Close Namespace BG
\ No newline at end of file
+}; // Close Namespace BG
@@ -11,8 +11,19 @@
 #pragma once
 
 // Standard Libraries (BG convention: use <> instead of "")
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <future>
+#include <random>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 // Third-Party Libraries (BG convention: use <> instead of "")
 #include <rpc/client.h>
@@ -23,6 +34,8 @@
 #include <RPC/StaticRoutes.h>
 #include <RPC/RouteAndHandler.h>
 
+#include <Util/LatencyTracker.h>
+
 #include <BG/Common/Logger/Logger.h>
 
 #include <Config/Config.h>
@@ -31,43 +44,223 @@
 
 namespace BG {
 
+#define SINGLE_FLIGHT_SWEEP_SIZE 64 /**Size of the in-flight table at which answered queries are swept out*/
+#define HEDGE_QUANTILE 0.95 /**Read-only queries slower than this quantile of their route are hedged*/
+#define HEDGE_WAIT_TURN_ms 2 /**How long a waiter on a hedged query watches one reply before looking at the other*/
+
+
+/**
+ * @brief One query of a pipelined batch, see SafeClient::MakeJSONQueries().
+ */
+struct JSONQuery {
+    std::string Route_; /**Route called on the service*/
+    std::string Query_; /**Serialized JSON argument*/
+    int Deadline_ms_ = -1; /**Time the caller waits for the reply, <= 0 uses the client's RPC timeout*/
+};
+
+/**
+ * @brief Outcome of an asynchronous query.
+ */
+struct QueryResult {
+    bool Success_ = false; /**False if the call failed, timed out or the remote returned an error*/
+    std::string Response_; /**Serialized JSON response if successful*/
+};
+
 
+/**
+ * @brief Client to an upstream RPC service (NES, or the API service) that survives disconnects.
+ *
+ * Internally this holds a fixed pool of connections. Each query checks out one healthy connection,
+ * uses it exclusively and hands it back, so concurrent callers never share a socket. Checkout and
+ * return are lock-free in the common case, a mutex is only taken when every connection is busy.
+ *
+ * Every connection carries its own health. A connection that fails is marked unhealthy and is not
+ * handed out again until the manager thread has reconnected it, and the manager only reconnects
+ * connections it has checked out itself, so a client is never replaced under a running call.
+ *
+ * Read-only queries can be given a per-call deadline and, if enabled, are hedged: when a reply is
+ * slower than the route's recent p95, the query is sent once more on another connection.
+ */
 class SafeClient {
 
 private:
 
-    std::unique_ptr<::rpc::client> Client_; /**Client to upstream NES Service*/
-    std::atomic_bool IsHealthy_; /**Boolean indicating if the client is healhy or not*/
+    /**
+     * @brief One pooled connection, only touched by whoever has checked it out.
+     */
+    struct Connection {
+        std::shared_ptr<::rpc::client> Client_; /**rpclib client, nullptr until first connected, shared with asynchronous calls still in flight*/
+        std::atomic_bool InUse_; /**True while checked out*/
+        std::atomic_bool IsHealthy_; /**True if the last call or version check on this connection succeeded*/
+        std::atomic_bool HasClient_; /**Mirrors Client_ != nullptr, so it can be read without checking the connection out*/
+        std::atomic<std::int64_t> LastSuccess_ms_; /**Steady clock time of the last successful call, real traffic counts as a heartbeat*/
+        unsigned int Generation_ = 0; /**Value of ConnectGeneration_ this connection was made for*/
+
+        int ConnectFailures_ = 0; /**Consecutive failed reconnects, drives the backoff (manager thread only)*/
+        std::chrono::steady_clock::time_point NextConnectAttempt_; /**Earliest time of the next reconnect (manager thread only)*/
+
+        Connection() : InUse_(false), IsHealthy_(false), HasClient_(false), LastSuccess_ms_(0) {}
+    };
+
+    /**
+     * @brief A sent query whose reply may be shared by several callers (and may be hedged).
+     */
+    struct InFlightQuery {
+        std::shared_future<clmdep_msgpack::object_handle> Reply_; /**Reply as matched by rpclib*/
+        std::shared_ptr<::rpc::client> Client_; /**Keeps the client alive until the reply is collected*/
+        Connection* Target_ = nullptr; /**Connection the query was sent on, for health bookkeeping*/
+        std::chrono::steady_clock::time_point SentAt_; /**When the query was written*/
+        std::chrono::steady_clock::time_point Deadline_; /**Waiters give up after this*/
+        EVM::Util::LatencyTracker* Latency_ = nullptr; /**Latency window of the route, fed with the first successful reply*/
+        std::atomic_bool Recorded_{false}; /**True once the latency was recorded*/
+
+        std::chrono::steady_clock::time_point HedgeAt_; /**A duplicate is sent if there is no reply by then, max() = never*/
+        std::string Route_; /**Copy of the route, only kept if the query may be hedged*/
+        std::string Query_; /**Copy of the argument, only kept if the query may be hedged*/
+        std::once_flag HedgeOnce_; /**The first waiter past HedgeAt_ sends the duplicate*/
+        std::shared_future<clmdep_msgpack::object_handle> HedgeReply_; /**Reply of the duplicate, invalid if none was sent*/
+        std::shared_ptr<::rpc::client> HedgeClient_; /**Keeps the duplicate's client alive*/
+        Connection* HedgeTarget_ = nullptr; /**Connection the duplicate was sent on*/
+    };
+
+    /**
+     * @brief Hands a checked out connection back when it goes out of scope.
+     */
+    class Lease {
+    private:
+        SafeClient* Owner_ = nullptr;
+        Connection* Connection_ = nullptr;
+    public:
+        Lease(SafeClient* _Owner, Connection* _Connection) : Owner_(_Owner), Connection_(_Connection) {}
+        ~Lease() { if (Connection_ != nullptr) { Owner_->Return(Connection_); } }
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        Connection& operator*() const { return *Connection_; }
+        explicit operator bool() const { return Connection_ != nullptr; }
+    };
+
+    std::vector<std::unique_ptr<Connection>> Pool_; /**Fixed set of connections, the vector itself never changes after construction*/
+    std::atomic<unsigned int> NextSlot_; /**Round-robin start point of the checkout scan*/
+    std::atomic<int> Waiters_; /**Callers blocked in Checkout(), Return() only notifies if this is non-zero*/
+    std::mutex ReturnMutex_; /**Only used to wait for a connection to be returned*/
+    std::condition_variable ReturnCondition_; /**Signalled when a connection is returned while someone waits*/
+
     std::atomic_bool RequestExit_; /**Indicates if the thread is to be terminated or not*/
+    std::atomic_bool UseSharedMemory_; /**If true, bulk arrays are requested as shared memory segments instead of inline JSON*/
+    std::atomic_bool SingleFlight_; /**If true, identical concurrent read-only queries share one round trip*/
+    std::mutex InFlightMutex_; /**Protects InFlight_*/
+    std::atomic_bool Hedging_; /**If true, slow read-only queries get a duplicate on another connection*/
+    std::atomic<std::uint64_t> HedgesSent_; /**Number of duplicates sent, for diagnostics*/
+    std::mutex LatencyMutex_; /**Protects RouteLatency_ (not the trackers, they are thread-safe)*/
+    std::unordered_map<std::string, std::unique_ptr<EVM::Util::LatencyTracker>> RouteLatency_; /**Recent reply latencies per route, entries are never removed*/
+    std::unordered_map<std::string, std::shared_ptr<InFlightQuery>> InFlight_; /**Read-only queries awaiting their reply, keyed by route and payload*/
+    std::atomic<unsigned int> ConnectGeneration_; /**Bumped by Reconnect(), connections of older generations are remade*/
     
     BG::Common::Logger::LoggingSystem* Logger_ = nullptr; /**Pointer to the instance of the logging system*/
 
-    std::thread ClientManager_; /**Thread that owns the client, and autoreconnects, etc.*/
+    std::thread ClientManager_; /**Thread that (re)connects the pooled connections and checks their health*/
 
-    bool LastState_ = false;
+    bool LastState_ = false; /**Whether any connection was healthy at the last check, only used by the manager thread*/
+    std::mt19937 Random_; /**Jitter source for the reconnect backoff, only used by the manager thread*/
 
+    std::atomic<int> IdleProbeInterval_ms_; /**A healthy connection is only probed after this long without successful traffic*/
+    std::atomic<int> BackoffMin_ms_; /**First reconnect delay after a failure*/
+    std::atomic<int> BackoffMax_ms_; /**Upper bound of the reconnect delay*/
 
 
+    std::mutex ConfigMutex_; /**Protects the target below, which is set from other threads*/
     std::string RPCHost_ = "";
     int RPCPort_ = -1;
     int RPCTimeout_ms = -1;
 
 
     void RPCManagerThread();
-    bool RunVersionCheck();
-    bool Connect();
+    bool RunVersionCheck(Connection& _Connection);
+    bool Connect(Connection& _Connection);
+
+    /**
+     * @brief Checks or repairs one connection that the manager thread has checked out.
+     * Healthy connections are only probed when idle, failed ones are reconnected with jittered exponential backoff.
+     */
+    void MaintainConnection(Connection& _Connection);
+
+    /**
+     * @brief Records a successful call on the connection (the traffic-based heartbeat).
+     */
+    static void MarkSuccess(Connection& _Connection);
+
+    /**
+     * @brief Claims a free connection without blocking.
+     * 
+     * @param _RequireHealthy If false, unhealthy connections that have a client are also handed out (for forced queries).
+     * @param _Exclude Connection that must not be handed out, e.g. the one a hedged query is stuck on.
+     * @return Connection* The claimed connection, or nullptr if none is free.
+     */
+    Connection* TryCheckout(bool _RequireHealthy, const Connection* _Exclude = nullptr);
+
+    /**
+     * @brief Claims a free connection, waiting up to the RPC timeout (or _MaxWait_ms if shorter) if all are busy.
+     * Returns nullptr right away if no connection could be used even when free.
+     */
+    Connection* Checkout(bool _RequireHealthy, int _MaxWait_ms = -1);
+
+    /**
+     * @brief Hands a connection back to the pool.
+     */
+    void Return(Connection* _Connection);
+
+    /**
+     * @brief Returns true if at least one connection could be handed out.
+     */
+    bool HasUsableConnection(bool _RequireHealthy) const;
+
+    /**
+     * @brief Runs the call on a checked out connection, marking it unhealthy if the link failed.
+     */
+    template <typename... Args>
+    bool Call(Connection& _Connection, const std::string& _Route, std::string* _Result, Args... _Args);
+
+    /**
+     * @brief Returns a future that waits for the query's reply until the deadline and converts it, never throws.
+     * Any number of futures may be made for the same query. Past the query's hedge point the first of them sends the duplicate.
+     * 
+     * @param _Query 
+     * @param _Deadline The caller's own deadline, capped to the query's.
+     */
+    std::future<QueryResult> CollectReply(std::shared_ptr<InFlightQuery> _Query, std::chrono::steady_clock::time_point _Deadline);
+
+    /**
+     * @brief Converts a ready reply, logging and updating the connection's health. Returns false on failure.
+     */
+    bool ConvertReply(const std::shared_future<clmdep_msgpack::object_handle>& _Reply, Connection* _Target, QueryResult& _Result);
+
+    /**
+     * @brief Sends the query again on another free, healthy connection, if there is one.
+     * Waiters then take turns on both replies until either is ready.
+     */
+    void SendHedge(const std::shared_ptr<InFlightQuery>& _Query);
+
+    /**
+     * @brief Returns the latency window of the route, creating it on first use.
+     */
+    EVM::Util::LatencyTracker* GetRouteLatency(const std::string& _Route);
+
+    /**
+     * @brief Returns the entry of an identical query still waiting for its reply, or nullptr.
+     * The caller must hold InFlightMutex_.
+     */
+    std::shared_ptr<InFlightQuery> FindInFlight(const std::string& _Key) const;
 
 public:
 
     /**
      * @brief Construct a new SafeClient object
-     * Give this a pointer to an initialized configuration object.
      * Also it takes a pointer to the logging system instance.
      * 
-     * @param _Config 
      * @param _Logger
+     * @param _PoolSize Number of connections kept to the service (at least 1).
      */
-    SafeClient(BG::Common::Logger::LoggingSystem* _Logger);
+    SafeClient(BG::Common::Logger::LoggingSystem* _Logger, int _PoolSize = 1);
 
 
     /**
@@ -79,12 +272,128 @@ public:
 
     bool SetTimeout(int _Timeout_ms);
     bool SetHostPort(std::string _Host, int _Port);
+
+    /**
+     * @brief Sets how connection health is checked.
+     * 
+     * @param _IdleProbeInterval_ms A connection is only probed with GetAPIVersion after this long without a successful call.
+     * @param _BackoffMin_ms First delay before reconnecting a failed connection, doubled (with jitter) after each failure.
+     * @param _BackoffMax_ms Upper bound of the reconnect delay.
+     */
+    void SetHealthCheckTiming(int _IdleProbeInterval_ms, int _BackoffMin_ms, int _BackoffMax_ms);
+
+    /**
+     * @brief Marks every connection for reconnection, e.g. after the target changed.
+     * Connections that are in use are remade once they are returned.
+     */
     void Reconnect();
 
+    /**
+     * @brief Selects how bulk arrays (positions, recordings) are requested from NES.
+     * Shared memory only works when NES runs on the same host, see Util::DecodeBulkArray().
+     * 
+     * @param _UseSharedMemory If true, requests ask for "BulkTransport": "SHM".
+     */
+    void SetSharedMemoryTransport(bool _UseSharedMemory);
+    bool UsesSharedMemoryTransport() const;
+
+    /**
+     * @brief Enables or disables single-flight coalescing (on by default).
+     * While enabled, a read-only query that is identical (route and payload) to one still waiting for
+     * its reply does not go out again, it gets the reply of the earlier one. Forced queries, and queries
+     * for shared memory transport, are never coalesced (see IsShareableQuery()).
+     * 
+     * @param _Enabled 
+     */
+    void SetSingleFlight(bool _Enabled);
+
+    /**
+     * @brief Enables or disables hedging of read-only queries (off by default).
+     * While enabled, a read-only query that has no reply after the route's recent p95 latency is sent
+     * once more on another free connection, and whichever reply arrives first is used. Needs a pool of at least 2.
+     * 
+     * @param _Enabled 
+     */
+    void SetHedging(bool _Enabled);
+
+    /**
+     * @brief Returns the number of hedge duplicates sent so far.
+     */
+    std::uint64_t GetHedgeCount() const;
+
+    /**
+     * @brief Returns true if the route only reads state, i.e. its name starts with "Get".
+     * Only these routes are coalesced and hedged. The status route "" is not among them: its answer depends
+     * on processes the caller has just started, which an identical query sent earlier may not cover.
+     */
+    static bool IsReadOnlyRoute(const std::string& _Route);
+
+    /**
+     * @brief Returns true if the query may be coalesced and hedged: its route is read-only and it does not
+     * ask for "BulkTransport": "SHM". A shared memory segment in a reply can only be mapped by one reader,
+     * which unlinks it, and a duplicate request would make NES create a segment nobody ever opens.
+     */
+    static bool IsShareableQuery(const std::string& _Route, const std::string& _Query);
+
+    /**
+     * @brief Returns the number of pooled connections.
+     */
+    int GetPoolSize() const;
+
+    /**
+     * @brief Returns true if at least one pooled connection is currently healthy.
+     */
+    bool IsHealthy() const;
+
     bool MakeJSONQuery(std::string _Route, std::string* _Result, bool _ForceQuery = false);
-    bool MakeJSONQuery(std::string _Route, std::string _Query, std::string* _Result, bool _ForceQuery = false);
+
+    /**
+     * @brief Sends the query and waits for the reply.
+     * 
+     * @param _Route 
+     * @param _Query 
+     * @param _Result 
+     * @param _ForceQuery Also use unhealthy connections (never coalesced or hedged).
+     * @param _Deadline_ms Longest time to wait for a connection and the reply, <= 0 uses the RPC timeout.
+     * @return true if successful.
+     */
+    bool MakeJSONQuery(std::string _Route, std::string _Query, std::string* _Result, bool _ForceQuery = false, int _Deadline_ms = -1);
+
+    /**
+     * @brief Sends the query without waiting for the reply.
+     * The connection is only held while the request is written, so other queries can be pipelined behind it.
+     * Call get() on the returned future to collect the result, it waits at most the RPC timeout
+     * (counted from when the query was sent) and never throws.
+     * 
+     * @param _Route 
+     * @param _Query 
+     * @param _ForceQuery 
+     * @param _Deadline_ms Replaces the RPC timeout for this query if > 0.
+     * @return std::future<QueryResult> 
+     */
+    std::future<QueryResult> MakeJSONQueryAsync(std::string _Route, std::string _Query, bool _ForceQuery = false, int _Deadline_ms = -1);
+
+    /**
+     * @brief Sends all queries back to back on one connection, then collects the replies.
+     * The total wait is about one round trip plus the service's processing time, instead of one round trip per query.
+     * 
+     * @param _Queries 
+     * @param _ForceQuery 
+     * @return std::vector<std::future<QueryResult>> One future per query, in the same order.
+     */
+    std::vector<std::future<QueryResult>> MakeJSONQueriesAsync(const std::vector<JSONQuery>& _Queries, bool _ForceQuery = false);
+
+    /**
+     * @brief Blocking form of MakeJSONQueriesAsync().
+     * 
+     * @param _Queries 
+     * @param _Results Filled with one result per query, in the same order.
+     * @param _ForceQuery 
+     * @return true if every query succeeded.
+     */
+    bool MakeJSONQueries(const std::vector<JSONQuery>& _Queries, std::vector<QueryResult>& _Results, bool _ForceQuery = false);
 
 
 };
 
-}; // Close Namespace BG
\ No newline at end of file
+}; // Close Namespace BG
@@ -0,0 +1,131 @@
+//=================================//
+// This file is part of BrainGenix //
+//=================================//
+
+
+// Standard Libraries (BG convention: use <> instead of "")
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+#include <nlohmann/json.hpp>
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <Util/BulkArray.h>
+#include <Util/FastJSON.h>
+#include <Util/JSONHelpers.h>
+
+
+
+namespace BG {
+namespace EVM {
+namespace Util {
+
+
+// Wire names of the element types, as used in the "DType" of a descriptor
+template <typename T> static const char* DTypeName();
+template <> const char* DTypeName<int>() { return "int32"; }
+template <> const char* DTypeName<std::int64_t>() { return "int64"; }
+template <> const char* DTypeName<float>() { return "float32"; }
+template <> const char* DTypeName<double>() { return "float64"; }
+
+
+// True for non-negative integers, however they were stored
+static bool IsSize(const nlohmann::json& _Value) {
+    return _Value.is_number_unsigned() || (_Value.is_number_integer() && _Value.get<std::int64_t>() >= 0);
+}
+
+
+template <typename T>
+static bool MapDescriptor(const nlohmann::json& _Descriptor, BulkArray<T>& _Out) {
+    if (!_Descriptor.is_object() || !_Descriptor.contains("SHMName") || !_Descriptor["SHMName"].is_string()) {
+        return false;
+    }
+
+    // The segment is handed over to us, so its name is removed even if the rest of the descriptor is unusable
+    std::string Name = _Descriptor["SHMName"].template get<std::string>();
+    std::shared_ptr<SharedMemoryView> View = std::make_shared<SharedMemoryView>();
+    if (!View->Open(Name)) {
+        UnlinkSharedMemory(Name);
+        return false;
+    }
+
+    if (_Descriptor.value("DType", std::string()) != DTypeName<T>()) {
+        return false;
+    }
+    if (!_Descriptor.contains("Count") || !IsSize(_Descriptor["Count"]) || (_Descriptor.contains("Offset") && !IsSize(_Descriptor["Offset"]))) {
+        return false;
+    }
+    std::uint64_t Offset = _Descriptor.value("Offset", std::uint64_t(0));
+    std::uint64_t Count = _Descriptor["Count"].template get<std::uint64_t>();
+    if (Offset % alignof(T) != 0) {
+        return false;
+    }
+
+    // Never trust the descriptor further than the segment reaches
+    if (Offset > View->Size() || Count > (View->Size() - Offset) / sizeof(T)) {
+        return false;
+    }
+
+    const T* Data = reinterpret_cast<const T*>(static_cast<const char*>(View->Data()) + Offset);
+    _Out.AssignView(std::move(View), Data, size_t(Count));
+    return true;
+}
+
+
+template <typename T>
+bool DecodeBulkArray(const std::string& _JSON, const std::string& _Pointer, BulkArray<T>& _Out) {
+
+    // Inline arrays are the common case, try those first
+    std::vector<T> Values;
+    if (ExtractNumberArray(_JSON, _Pointer, Values)) {
+        _Out.Assign(std::move(Values));
+        return true;
+    }
+
+    // Otherwise it may be a shared memory descriptor, such responses are small so a DOM is fine here
+    nlohmann::json Document = nlohmann::json::parse(_JSON, nullptr, false);
+    if (Document.is_discarded()) {
+        return false;
+    }
+    try {
+        nlohmann::json::json_pointer Pointer(_Pointer);
+        if (!Document.contains(Pointer)) {
+            return false;
+        }
+        return MapDescriptor(Document.at(Pointer), _Out);
+    } catch (nlohmann::json::exception&) {
+        return false;
+    }
+}
+
+
+template <typename T>
+bool DecodeBulkArray(const nlohmann::json& _Value, BulkArray<T>& _Out) {
+    if (_Value.is_array()) {
+        std::vector<T> Values;
+        if (!GetNumberArray(_Value, Values)) {
+            return false;
+        }
+        _Out.Assign(std::move(Values));
+        return true;
+    }
+    try {
+        return MapDescriptor(_Value, _Out);
+    } catch (nlohmann::json::exception&) {
+        return false;
+    }
+}
+
+
+template bool DecodeBulkArray<int>(const std::string&, const std::string&, BulkArray<int>&);
+template bool DecodeBulkArray<std::int64_t>(const std::string&, const std::string&, BulkArray<std::int64_t>&);
+template bool DecodeBulkArray<float>(const std::string&, const std::string&, BulkArray<float>&);
+template bool DecodeBulkArray<double>(const std::string&, const std::string&, BulkArray<double>&);
+template bool DecodeBulkArray<int>(const nlohmann::json&, BulkArray<int>&);
+template bool DecodeBulkArray<std::int64_t>(const nlohmann::json&, BulkArray<std::int64_t>&);
+template bool DecodeBulkArray<float>(const nlohmann::json&, BulkArray<float>&);
+template bool DecodeBulkArray<double>(const nlohmann::json&, BulkArray<double>&);
+
+
+}; // Close Namespace Util
+}; // Close Namespace EVM
+}; // Close Namespace BG
@@ -0,0 +1,176 @@
+//=================================================================//
+// This file is part of the BrainGenix-EVM Neuron Emulation System //
+//=================================================================//
+
+/*
+    Description: This file provides typed bulk arrays that are either decoded from JSON or viewed in shared memory.
+    Additional Notes: None
+    Date Created: 2024-05-27
+*/
+
+#pragma once
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+#include <nlohmann/json.hpp>
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <Util/SharedMemory.h>
+
+
+
+namespace BG {
+namespace EVM {
+namespace Util {
+
+
+/**
+ * @brief Read-only contiguous array of numbers received from NES.
+ *
+ * The values either live in an owned vector (decoded from the JSON text) or directly in a shared
+ * memory segment that NES filled in, in which case nothing is copied. Users only see data() and size().
+ * Copies share the segment.
+ */
+template <typename T>
+class BulkArray {
+
+private:
+
+    std::vector<T> Owned_; /**Values decoded from JSON*/
+    std::shared_ptr<SharedMemoryView> View_; /**Keeps the segment mapped while the array (or a copy of it) exists*/
+    const T* Data_ = nullptr; /**Start of the values, in Owned_ or in View_*/
+    size_t Size_ = 0; /**Number of values*/
+
+public:
+
+    BulkArray() = default;
+
+    BulkArray(const BulkArray& _Other) {
+        *this = _Other;
+    }
+
+    BulkArray(BulkArray&& _Other) {
+        *this = std::move(_Other);
+    }
+
+    BulkArray& operator=(BulkArray&& _Other) {
+        if (this == &_Other) {
+            return *this;
+        }
+        if (_Other.View_ != nullptr) {
+            AssignView(std::move(_Other.View_), _Other.Data_, _Other.Size_);
+        } else {
+            Assign(std::move(_Other.Owned_));
+        }
+        _Other.Assign(std::vector<T>());
+        return *this;
+    }
+
+    BulkArray& operator=(const BulkArray& _Other) {
+        if (this == &_Other) {
+            return *this;
+        }
+        if (_Other.View_ != nullptr) {
+            AssignView(_Other.View_, _Other.Data_, _Other.Size_);
+        } else {
+            Assign(std::vector<T>(_Other.Owned_));
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Takes ownership of decoded values.
+     */
+    void Assign(std::vector<T>&& _Values) {
+        View_.reset();
+        Owned_ = std::move(_Values);
+        Data_ = Owned_.data();
+        Size_ = Owned_.size();
+    }
+
+    /**
+     * @brief Points the array at values inside a mapped segment.
+     */
+    void AssignView(std::shared_ptr<SharedMemoryView> _View, const T* _Data, size_t _Size) {
+        Owned_.clear();
+        Owned_.shrink_to_fit();
+        View_ = std::move(_View);
+        Data_ = _Data;
+        Size_ = _Size;
+    }
+
+    const T* data() const {
+        return Data_;
+    }
+
+    size_t size() const {
+        return Size_;
+    }
+
+    bool empty() const {
+        return Size_ == 0;
+    }
+
+    const T& operator[](size_t _Index) const {
+        return Data_[_Index];
+    }
+
+    const T* begin() const {
+        return Data_;
+    }
+
+    const T* end() const {
+        return Data_ + Size_;
+    }
+
+    /**
+     * @brief Returns true if the values are read straight from shared memory.
+     */
+    bool IsZeroCopy() const {
+        return View_ != nullptr;
+    }
+
+};
+
+
+/**
+ * @brief Decodes the array at _Pointer of a NES response into _Out.
+ *
+ * The value at _Pointer is either a (possibly nested) numeric array, decoded with ExtractNumberArray(),
+ * or a shared memory descriptor written by NES when the request asked for "BulkTransport": "SHM":
+ *     {"SHMName": "/segment", "Offset": <bytes>, "Count": <values>, "DType": "float32"|"float64"|"int32"|"int64"}
+ * The DType has to match T exactly, the segment is then mapped read-only and not copied.
+ * A named segment is always unlinked, also if its descriptor is rejected, since nobody else will pick it up.
+ * Instantiated for int, std::int64_t, float and double.
+ *
+ * @param _JSON Raw JSON text of the response.
+ * @param _Pointer JSON pointer of the array, e.g. "/0/SomaPositions".
+ * @param _Out Destination.
+ * @return true on success.
+ */
+template <typename T>
+bool DecodeBulkArray(const std::string& _JSON, const std::string& _Pointer, BulkArray<T>& _Out);
+
+/**
+ * @brief Same as above, for a value of an already parsed response.
+ * Used for descriptors of a batched response, whose inline arrays are decoded by pointer instead.
+ *
+ * @param _Value Numeric array (may be nested) or shared memory descriptor.
+ * @param _Out Destination.
+ * @return true on success.
+ */
+template <typename T>
+bool DecodeBulkArray(const nlohmann::json& _Value, BulkArray<T>& _Out);
+
+
+
+}; // Close Namespace Util
+}; // Close Namespace EVM
+}; // Close Namespace BG
@@ -0,0 +1,147 @@
+//=================================//
+// This file is part of BrainGenix //
+//=================================//
+
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <type_traits>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+#ifdef BG_EVM_WITH_SIMDJSON
+#include <simdjson.h>
+#endif
+#include <nlohmann/json.hpp>
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <Util/FastJSON.h>
+#include <Util/JSONHelpers.h>
+
+
+
+namespace BG {
+namespace EVM {
+namespace Util {
+
+
+#ifdef BG_EVM_WITH_SIMDJSON
+
+bool HasFastJSON() {
+    return true;
+}
+
+// Appends every number below _Value (recursing into nested arrays) to _Out.
+template <typename T>
+static simdjson::error_code FlattenNumbers(simdjson::ondemand::value _Value, std::vector<T>& _Out) {
+    simdjson::ondemand::json_type Type;
+    simdjson::error_code Error = _Value.type().get(Type);
+    if (Error) {
+        return Error;
+    }
+
+    if (Type == simdjson::ondemand::json_type::number) {
+        if constexpr (std::is_integral<T>::value) {
+            std::int64_t Number;
+            Error = _Value.get_int64().get(Number);
+            if (!Error) {
+                _Out.push_back(T(Number));
+            }
+        } else {
+            double Number;
+            Error = _Value.get_double().get(Number);
+            if (!Error) {
+                _Out.push_back(T(Number));
+            }
+        }
+        return Error;
+    }
+
+    if (Type != simdjson::ondemand::json_type::array) {
+        return simdjson::INCORRECT_TYPE;
+    }
+
+    simdjson::ondemand::array Array;
+    Error = _Value.get_array().get(Array);
+    if (Error) {
+        return Error;
+    }
+    for (simdjson::simdjson_result<simdjson::ondemand::value> Element : Array) {
+        simdjson::ondemand::value Child;
+        Error = Element.get(Child);
+        if (Error) {
+            return Error;
+        }
+        Error = FlattenNumbers(Child, _Out);
+        if (Error) {
+            return Error;
+        }
+    }
+    return simdjson::SUCCESS;
+}
+
+template <typename T>
+bool ExtractNumberArray(const std::string& _JSON, const std::string& _Pointer, std::vector<T>& _Out) {
+    _Out.clear();
+
+    // The parser keeps its internal buffers between calls, one per thread
+    thread_local simdjson::ondemand::parser Parser;
+
+    // simdjson needs SIMDJSON_PADDING readable bytes past the end, only copy the text if the string cannot provide them
+    simdjson::padded_string Copy;
+    simdjson::padded_string_view Input;
+    if (_JSON.capacity() - _JSON.size() >= simdjson::SIMDJSON_PADDING) {
+        Input = simdjson::padded_string_view(_JSON.data(), _JSON.size(), _JSON.capacity());
+    } else {
+        Copy = simdjson::padded_string(_JSON);
+        Input = Copy;
+    }
+
+    simdjson::ondemand::document Document;
+    if (Parser.iterate(Input).get(Document)) {
+        return false;
+    }
+    simdjson::ondemand::value Array;
+    if (Document.at_pointer(_Pointer).get(Array)) {
+        return false;
+    }
+    return FlattenNumbers(Array, _Out) == simdjson::SUCCESS;
+}
+
+#else
+
+bool HasFastJSON() {
+    return false;
+}
+
+template <typename T>
+bool ExtractNumberArray(const std::string& _JSON, const std::string& _Pointer, std::vector<T>& _Out) {
+    _Out.clear();
+
+    nlohmann::json Document = nlohmann::json::parse(_JSON, nullptr, false);
+    if (Document.is_discarded()) {
+        return false;
+    }
+
+    nlohmann::json::json_pointer Pointer;
+    try {
+        Pointer = nlohmann::json::json_pointer(_Pointer);
+    } catch (nlohmann::json::parse_error&) {
+        return false;
+    }
+    if (!Document.contains(Pointer)) {
+        return false;
+    }
+    return GetNumberArray(Document.at(Pointer), _Out);
+}
+
+#endif
+
+
+template bool ExtractNumberArray<int>(const std::string&, const std::string&, std::vector<int>&);
+template bool ExtractNumberArray<std::int64_t>(const std::string&, const std::string&, std::vector<std::int64_t>&);
+template bool ExtractNumberArray<float>(const std::string&, const std::string&, std::vector<float>&);
+template bool ExtractNumberArray<double>(const std::string&, const std::string&, std::vector<double>&);
+
+
+}; // Close Namespace Util
+}; // Close Namespace EVM
+}; // Close Namespace BG
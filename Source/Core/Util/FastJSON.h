@@ -0,0 +1,56 @@
+//=================================================================//
+// This file is part of the BrainGenix-EVM Neuron Emulation System //
+//=================================================================//
+
+/*
+    Description: This file provides DOM-free extraction of large numeric arrays from raw NES responses.
+    Additional Notes: Uses simdjson when built with BG_EVM_WITH_SIMDJSON, otherwise falls back to nlohmann::json.
+    Date Created: 2024-02-12
+*/
+
+#pragma once
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+
+// Internal Libraries (BG convention: use <> instead of "")
+
+
+
+namespace BG {
+namespace EVM {
+namespace Util {
+
+
+/**
+ * @brief Returns true if this build parses with simdjson (on demand, no DOM) rather than nlohmann::json.
+ */
+bool HasFastJSON();
+
+
+/**
+ * @brief Extracts the numeric array at _Pointer from the raw JSON text _JSON into a contiguous buffer.
+ * Nested arrays are flattened in document order (e.g. [[x,y,z],...] -> x0,y0,z0,x1,...).
+ *
+ * With simdjson the numbers are parsed directly out of the text without building a document,
+ * which is what makes this worth calling for soma positions, spike times and similar bulk data.
+ * Instantiated for int, std::int64_t, float and double.
+ *
+ * @param _JSON Raw JSON text, e.g. the response string from SafeClient::MakeJSONQuery.
+ * @param _Pointer RFC 6901 JSON pointer of the array, e.g. "/0/SomaPositions".
+ * @param _Out Destination buffer, replaced with the values found.
+ * @return true on success, false if the text does not parse, the pointer is missing or the array is not numeric
+ * (for integral T, also if it holds a non-integer number). Both builds accept and reject the same arrays.
+ */
+template <typename T>
+bool ExtractNumberArray(const std::string& _JSON, const std::string& _Pointer, std::vector<T>& _Out);
+
+
+
+}; // Close Namespace Util
+}; // Close Namespace EVM
+}; // Close Namespace BG
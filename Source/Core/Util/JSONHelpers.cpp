@@ -72,28 +72,93 @@ void SetVec3(nlohmann::json* _Target, std::string _Input, std::string _Prefix, s
 
 void GetIntVector(std::vector<int>* _Vector, const nlohmann::json* _Input, std::string _JSONKey) {
     _Vector->clear();
-    nlohmann::json Vector = (*_Input).at(_JSONKey);
-    for (nlohmann::json::iterator it = Vector.begin(); it != Vector.end(); it++) {
-        _Vector->push_back(it.value());
-    }    
+    const nlohmann::json& Vector = (*_Input).at(_JSONKey);
+    _Vector->reserve(Vector.size());
+    for (const nlohmann::json& Element : Vector) {
+        _Vector->push_back(Element.template get<int>());
+    }
 }
 
 void GetFloatVector(std::vector<float>* _Vector, const nlohmann::json* _Input, std::string _JSONKey) {
     _Vector->clear();
-    nlohmann::json Vector = (*_Input).at(_JSONKey);
-    for (nlohmann::json::iterator it = Vector.begin(); it != Vector.end(); it++) {
-        _Vector->push_back(it.value());
-    }    
+    const nlohmann::json& Vector = (*_Input).at(_JSONKey);
+    _Vector->reserve(Vector.size());
+    for (const nlohmann::json& Element : Vector) {
+        _Vector->push_back(Element.template get<float>());
+    }
 }
 
 void GetStringVector(std::vector<std::string>* _Vector, const nlohmann::json* _Input, std::string _JSONKey) {
     _Vector->clear();
-    nlohmann::json Vector = (*_Input).at(_JSONKey);
-    for (nlohmann::json::iterator it = Vector.begin(); it != Vector.end(); it++) {
-        _Vector->push_back(it.value());
-    }    
+    const nlohmann::json& Vector = (*_Input).at(_JSONKey);
+    _Vector->reserve(Vector.size());
+    for (const nlohmann::json& Element : Vector) {
+        _Vector->push_back(Element.template get_ref<const std::string&>());
+    }
+}
+
+
+// Counts the numeric leaves of a (possibly nested) array, returns false if anything else is found.
+// Integer buffers take integer leaves only, as the simdjson path does (see Util/FastJSON.h).
+template <typename T>
+static bool CountNumberLeaves(const nlohmann::json& _Value, size_t& _Count) {
+    if (std::is_integral<T>::value ? _Value.is_number_integer() : _Value.is_number()) {
+        _Count++;
+        return true;
+    }
+    if (!_Value.is_array()) {
+        return false;
+    }
+    for (const nlohmann::json& Element : _Value) {
+        if (!CountNumberLeaves<T>(Element, _Count)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Writes the numeric leaves in document order, assumes CountNumberLeaves has already validated the layout.
+template <typename T>
+static void WriteNumberLeaves(const nlohmann::json& _Value, T*& _Out) {
+    if (_Value.is_number()) {
+        *_Out++ = _Value.template get<T>();
+        return;
+    }
+    for (const nlohmann::json& Element : _Value) {
+        WriteNumberLeaves(Element, _Out);
+    }
+}
+
+template <typename T>
+bool GetNumberArray(const nlohmann::json& _Array, std::vector<T>& _Out) {
+    size_t Count = 0;
+    if (!CountNumberLeaves<T>(_Array, Count)) {
+        return false;
+    }
+    _Out.resize(Count);
+    T* Cursor = _Out.data();
+    WriteNumberLeaves(_Array, Cursor);
+    return true;
 }
 
+template <typename T>
+bool GetNumberArray(const nlohmann::json* _Input, const std::string& _JSONKey, std::vector<T>& _Out) {
+    nlohmann::json::const_iterator Array = _Input->find(_JSONKey);
+    if (Array == _Input->end()) {
+        return false;
+    }
+    return GetNumberArray(*Array, _Out);
+}
+
+template bool GetNumberArray<int>(const nlohmann::json&, std::vector<int>&);
+template bool GetNumberArray<std::int64_t>(const nlohmann::json&, std::vector<std::int64_t>&);
+template bool GetNumberArray<float>(const nlohmann::json&, std::vector<float>&);
+template bool GetNumberArray<double>(const nlohmann::json&, std::vector<double>&);
+template bool GetNumberArray<int>(const nlohmann::json*, const std::string&, std::vector<int>&);
+template bool GetNumberArray<std::int64_t>(const nlohmann::json*, const std::string&, std::vector<std::int64_t>&);
+template bool GetNumberArray<float>(const nlohmann::json*, const std::string&, std::vector<float>&);
+template bool GetNumberArray<double>(const nlohmann::json*, const std::string&, std::vector<double>&);
+
 }; // Close Namespace Util
 }; // Close Namespace EVM
 }; // Close Namespace BG
@@ -12,7 +12,10 @@
 
 // Standard Libraries (BG convention: use <> instead of "")
 #include <string>
+#include <vector>
+#include <cstdint>
 #include <iostream>
+#include <type_traits>
 
 // Third-Party Libraries (BG convention: use <> instead of "")
 #include <nlohmann/json.hpp>
@@ -137,6 +140,31 @@ void GetFloatVector(std::vector<float>* _Vector, const nlohmann::json* _Input, s
 void GetStringVector(std::vector<std::string>* _Vector, const nlohmann::json* _Input, std::string _JSONKey);
 
 
+/**
+ * @brief Copies the numbers of a JSON array straight into a contiguous typed buffer.
+ * Nested arrays are flattened in document order, so a list of positions such as [[x,y,z],...]
+ * ends up as x0,y0,z0,x1,... in _Out. The buffer is sized once, no intermediate JSON copy is made.
+ * Instantiated for int, std::int64_t, float and double.
+ *
+ * @param _Array JSON array (may be nested) containing only numbers, only integers if T is integral.
+ * @param _Out Destination buffer, resized to the number of values found.
+ * @return true on success, false if a non-numeric (or for integral T, non-integer) element was found.
+ */
+template <typename T>
+bool GetNumberArray(const nlohmann::json& _Array, std::vector<T>& _Out);
+
+/**
+ * @brief Same as above, but looks up the array under _JSONKey first.
+ *
+ * @param _Input Pointer to the JSON object.
+ * @param _JSONKey The key in the JSON object.
+ * @param _Out Destination buffer.
+ * @return true on success, false if the key is missing or the array is not numeric.
+ */
+template <typename T>
+bool GetNumberArray(const nlohmann::json* _Input, const std::string& _JSONKey, std::vector<T>& _Out);
+
+
 
 }; // Close Namespace Util
 }; // Close Namespace EVM
@@ -0,0 +1,58 @@
+//=================================//
+// This file is part of BrainGenix //
+//=================================//
+
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <algorithm>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <Util/LatencyTracker.h>
+
+
+
+namespace BG {
+namespace EVM {
+namespace Util {
+
+
+LatencyTracker::LatencyTracker(size_t _Window, size_t _MinSamples) {
+    Samples_.resize(std::max<size_t>(_Window, 1));
+    MinSamples_ = std::min(_MinSamples, Samples_.size());
+}
+
+void LatencyTracker::Record(double _Latency_ms) {
+    std::lock_guard<std::mutex> Lock(Mutex_);
+    Samples_[Next_] = _Latency_ms;
+    Next_ = (Next_ + 1) % Samples_.size();
+    Count_ = std::min(Count_ + 1, Samples_.size());
+    SinceUpdate_++;
+}
+
+double LatencyTracker::Quantile(double _Quantile) {
+    std::lock_guard<std::mutex> Lock(Mutex_);
+    if (Count_ < MinSamples_ || Count_ == 0) {
+        return -1.0;
+    }
+
+    // Rebuilding is a partial sort of the window, only do it once enough has changed
+    if (CachedFor_ == _Quantile && SinceUpdate_ < Samples_.size() / 16 + 1) {
+        return CachedQuantile_;
+    }
+
+    std::vector<double> Window(Samples_.begin(), Samples_.begin() + Count_);
+    size_t Rank = std::min(Count_ - 1, static_cast<size_t>(_Quantile * Count_));
+    std::nth_element(Window.begin(), Window.begin() + Rank, Window.end());
+
+    CachedQuantile_ = Window[Rank];
+    CachedFor_ = _Quantile;
+    SinceUpdate_ = 0;
+    return CachedQuantile_;
+}
+
+
+}; // Close Namespace Util
+}; // Close Namespace EVM
+}; // Close Namespace BG
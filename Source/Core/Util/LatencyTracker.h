@@ -0,0 +1,78 @@
+//=================================================================//
+// This file is part of the BrainGenix-EVM Neuron Emulation System //
+//=================================================================//
+
+/*
+    Description: This file provides a sliding-window latency tracker with cached quantiles.
+    Additional Notes: None
+    Date Created: 2024-05-21
+*/
+
+#pragma once
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <mutex>
+#include <vector>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+
+// Internal Libraries (BG convention: use <> instead of "")
+
+
+
+namespace BG {
+namespace EVM {
+namespace Util {
+
+
+/**
+ * @brief Keeps the most recent latency samples and answers quantile queries over them.
+ *
+ * Quantiles are recomputed at most once every few samples, so querying on every call is cheap.
+ * Safe to use from several threads.
+ */
+class LatencyTracker {
+
+private:
+
+    std::mutex Mutex_; /**Protects everything below*/
+    std::vector<double> Samples_; /**Ring of the most recent samples (ms)*/
+    size_t Next_ = 0; /**Slot the next sample is written to*/
+    size_t Count_ = 0; /**Number of valid samples, at most the window size*/
+    size_t MinSamples_ = 0; /**Quantiles are only reported once this many samples were seen*/
+
+    size_t SinceUpdate_ = 0; /**Samples recorded since the cache was rebuilt*/
+    double CachedQuantile_ = -1.0; /**Last computed quantile, -1 if not enough samples*/
+    double CachedFor_ = -1.0; /**Quantile the cache holds*/
+
+public:
+
+    /**
+     * @brief Construct a new LatencyTracker object
+     * 
+     * @param _Window Number of most recent samples kept.
+     * @param _MinSamples Quantiles are unknown (-1) until this many samples were recorded.
+     */
+    LatencyTracker(size_t _Window = 256, size_t _MinSamples = 20);
+
+    /**
+     * @brief Adds one sample.
+     * 
+     * @param _Latency_ms 
+     */
+    void Record(double _Latency_ms);
+
+    /**
+     * @brief Returns the given quantile (e.g. 0.95) of the window, or -1 if there are too few samples.
+     * 
+     * @param _Quantile Between 0 and 1.
+     * @return double 
+     */
+    double Quantile(double _Quantile);
+
+};
+
+
+}; // Close Namespace Util
+}; // Close Namespace EVM
+}; // Close Namespace BG
@@ -0,0 +1,119 @@
+//=================================//
+// This file is part of BrainGenix //
+//=================================//
+
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <exception>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <Util/LazyLogger.h>
+
+
+
+namespace BG {
+namespace EVM {
+namespace Util {
+
+
+LazyLogger::LazyLogger(BG::Common::Logger::LoggingSystem* _Sink, int _MinLevel, size_t _QueueSize) {
+    Sink_ = _Sink;
+    MinLevel_.store(_MinLevel);
+    Ring_.resize(_QueueSize > 0 ? _QueueSize : 1);
+    SinkThread_ = std::thread(&LazyLogger::SinkThread, this);
+}
+
+LazyLogger::~LazyLogger() {
+    {
+        std::lock_guard<std::mutex> Lock(RingMutex_);
+        RequestExit_ = true;
+    }
+    RingCondition_.notify_one();
+    SinkThread_.join();
+}
+
+
+void LazyLogger::SetMinLevel(int _MinLevel) {
+    MinLevel_.store(_MinLevel, std::memory_order_relaxed);
+}
+
+void LazyLogger::Push(Record&& _Record) {
+    {
+        std::lock_guard<std::mutex> Lock(RingMutex_);
+        if (Count_ == Ring_.size()) {
+            Dropped_++;
+            return;
+        }
+        Ring_[(Head_ + Count_) % Ring_.size()] = std::move(_Record);
+        Count_++;
+    }
+    RingCondition_.notify_one();
+}
+
+void LazyLogger::Flush() {
+    std::unique_lock<std::mutex> Lock(RingMutex_);
+    DrainedCondition_.wait(Lock, [this]() { return Count_ == 0 && !Writing_; });
+}
+
+std::uint64_t LazyLogger::GetDroppedCount() {
+    std::lock_guard<std::mutex> Lock(RingMutex_);
+    return Dropped_;
+}
+
+
+void LazyLogger::SinkThread() {
+
+    std::vector<Record> Batch;
+    Batch.reserve(Ring_.size());
+    std::uint64_t ReportedDrops = 0;
+
+    while (true) {
+
+        // Take everything that is queued, so producers only wait for the moves and not for the formatting
+        std::uint64_t NewDrops = 0;
+        {
+            std::unique_lock<std::mutex> Lock(RingMutex_);
+            RingCondition_.wait(Lock, [this]() { return Count_ > 0 || RequestExit_; });
+            if (Count_ == 0 && RequestExit_) {
+                return;
+            }
+            for (; Count_ > 0; Count_--) {
+                Batch.push_back(std::move(Ring_[Head_]));
+                Ring_[Head_] = Record();
+                Head_ = (Head_ + 1) % Ring_.size();
+            }
+            NewDrops = Dropped_ - ReportedDrops;
+            ReportedDrops = Dropped_;
+            Writing_ = true;
+        }
+
+        if (NewDrops > 0) {
+            Sink_->Log("Log Queue Full, Dropped " + std::to_string(NewDrops) + " Messages", 6);
+        }
+        for (Record& R : Batch) {
+            if (R.Literal_ != nullptr) {
+                Sink_->Log(R.Literal_, R.Level_);
+                continue;
+            }
+            try {
+                Sink_->Log(R.Format_(), R.Level_);
+            } catch (std::exception& e) {
+                Sink_->Log("Failed To Format Log Message: " + std::string(e.what()), 7);
+            }
+        }
+        Batch.clear();
+
+        {
+            std::lock_guard<std::mutex> Lock(RingMutex_);
+            Writing_ = false;
+        }
+        DrainedCondition_.notify_all();
+    }
+}
+
+
+}; // Close Namespace Util
+}; // Close Namespace EVM
+}; // Close Namespace BG
@@ -0,0 +1,162 @@
+//=================================================================//
+// This file is part of the BrainGenix-EVM Neuron Emulation System //
+//=================================================================//
+
+/*
+    Description: This file provides a level-gated logging facade with deferred formatting and an asynchronous sink.
+    Additional Notes: None
+    Date Created: 2024-05-13
+*/
+
+#pragma once
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <BG/Common/Logger/Logger.h>
+
+
+
+namespace BG {
+namespace EVM {
+namespace Util {
+
+
+/**
+ * @brief Logging facade used on the request paths.
+ *
+ * Messages below the minimum level are dropped before anything is formatted. Messages that pass
+ * are given as a callable returning the string, which is only invoked on the sink thread, e.g.:
+ *
+ *     Log_->Log(0, [ReqFunc]() { return "DEBUG -> Got Request For '" + ReqFunc + "'"; });
+ *
+ * The callable must capture by value, it runs after the caller has returned.
+ * Records are kept in a fixed-size ring. If the ring is full the record is dropped (and counted)
+ * instead of blocking the caller. The sink thread is the only one calling the wrapped LoggingSystem.
+ */
+class LazyLogger {
+
+private:
+
+    struct Record {
+        int Level_ = 0;                         /**Level passed on to the LoggingSystem*/
+        const char* Literal_ = nullptr;         /**Message with static storage, used instead of Format_ if set*/
+        std::function<std::string()> Format_;   /**Builds the message on the sink thread*/
+    };
+
+    BG::Common::Logger::LoggingSystem* Sink_ = nullptr; /**Logging system that finally receives the messages*/
+    std::atomic<int> MinLevel_; /**Messages below this level are dropped without formatting*/
+
+    std::vector<Record> Ring_; /**Fixed-size ring of pending records*/
+    size_t Head_ = 0;  /**Index of the oldest pending record*/
+    size_t Count_ = 0; /**Number of pending records*/
+    bool Writing_ = false; /**True while the sink thread is writing a batch it took out of the ring*/
+    std::uint64_t Dropped_ = 0; /**Records lost because the ring was full, reported by the sink thread*/
+
+    std::mutex RingMutex_; /**Protects the ring and counters above*/
+    std::condition_variable RingCondition_; /**Signalled when a record is queued or when exiting*/
+    std::condition_variable DrainedCondition_; /**Signalled when the sink thread has written everything*/
+    bool RequestExit_ = false; /**Set by the destructor, the sink thread drains the ring and exits*/
+
+    std::thread SinkThread_; /**Formats queued records and hands them to Sink_*/
+
+
+    /**
+     * @brief Puts a record into the ring, or counts it as dropped if the ring is full.
+     */
+    void Push(Record&& _Record);
+
+    /**
+     * @brief Main loop of the sink thread.
+     */
+    void SinkThread();
+
+public:
+
+    /**
+     * @brief Construct a new LazyLogger object
+     *
+     * @param _Sink Logging system that receives the formatted messages.
+     * @param _MinLevel Messages with a lower level are discarded.
+     * @param _QueueSize Number of records the ring holds before new ones are dropped.
+     */
+    LazyLogger(BG::Common::Logger::LoggingSystem* _Sink, int _MinLevel = 0, size_t _QueueSize = 4096);
+
+    /**
+     * @brief Destroy the LazyLogger object
+     * Everything still queued is written before the sink thread is joined.
+     */
+    ~LazyLogger();
+
+    LazyLogger(const LazyLogger&) = delete;
+    LazyLogger& operator=(const LazyLogger&) = delete;
+
+
+    /**
+     * @brief Returns true if a message with the given level would be logged.
+     * Use this to skip work that is only done to produce a log message.
+     */
+    bool IsEnabled(int _Level) const {
+        return _Level >= MinLevel_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Changes the minimum level at runtime.
+     */
+    void SetMinLevel(int _MinLevel);
+
+    /**
+     * @brief Logs a message with static storage (e.g. a string literal), nothing is copied.
+     */
+    void Log(int _Level, const char* _Message) {
+        if (!IsEnabled(_Level)) {
+            return;
+        }
+        Record R;
+        R.Level_ = _Level;
+        R.Literal_ = _Message;
+        Push(std::move(R));
+    }
+
+    /**
+     * @brief Logs the message returned by _Format, which is only called on the sink thread.
+     */
+    template <typename F>
+    void Log(int _Level, F&& _Format) {
+        if (!IsEnabled(_Level)) {
+            return;
+        }
+        Record R;
+        R.Level_ = _Level;
+        R.Format_ = std::forward<F>(_Format);
+        Push(std::move(R));
+    }
+
+    /**
+     * @brief Blocks until everything queued so far has been written to the sink.
+     */
+    void Flush();
+
+    /**
+     * @brief Returns the number of records dropped so far because the ring was full.
+     */
+    std::uint64_t GetDroppedCount();
+
+};
+
+
+
+}; // Close Namespace Util
+}; // Close Namespace EVM
+}; // Close Namespace BG
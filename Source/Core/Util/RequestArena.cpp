@@ -0,0 +1,68 @@
+// Standard Libraries (BG convention: use <> instead of "")
+#include <algorithm>
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <Util/RequestArena.h>
+
+namespace BG {
+namespace EVM {
+namespace Util {
+
+
+static thread_local RequestArena* CurrentArena_ = nullptr;
+
+
+RequestArena::RequestArena(size_t _InitialBlockSize) {
+    NextBlockSize_ = std::max(_InitialBlockSize, size_t(1024));
+}
+
+void* RequestArena::Allocate(size_t _Size) {
+    constexpr size_t Alignment = alignof(std::max_align_t);
+    size_t Size = (_Size + Alignment - 1) & ~(Alignment - 1);
+
+    if (Size > Remaining_) {
+        // Oversized requests get a block of their own, so that the rest of the current block is not wasted
+        size_t BlockSize = std::max(Size, NextBlockSize_);
+        Blocks_.emplace_back(new char[BlockSize]);
+        if (BlockSize == Size && Cursor_ != nullptr) {
+            BytesAllocated_ += Size;
+            return Blocks_.back().get();
+        }
+        Cursor_ = Blocks_.back().get();
+        Remaining_ = BlockSize;
+        NextBlockSize_ *= 2;
+    }
+
+    void* Pointer = Cursor_;
+    Cursor_ += Size;
+    Remaining_ -= Size;
+    BytesAllocated_ += Size;
+    return Pointer;
+}
+
+size_t RequestArena::GetBytesAllocated() const {
+    return BytesAllocated_;
+}
+
+RequestArena* RequestArena::Current() {
+    return CurrentArena_;
+}
+
+void RequestArena::SetCurrent(RequestArena* _Arena) {
+    CurrentArena_ = _Arena;
+}
+
+
+ScopedRequestArena::ScopedRequestArena(RequestArena& _Arena) {
+    Previous_ = RequestArena::Current();
+    RequestArena::SetCurrent(&_Arena);
+}
+
+ScopedRequestArena::~ScopedRequestArena() {
+    RequestArena::SetCurrent(Previous_);
+}
+
+
+}; // Close Namespace Util
+}; // Close Namespace EVM
+}; // Close Namespace BG
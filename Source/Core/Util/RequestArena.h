@@ -0,0 +1,164 @@
+//=================================================================//
+// This file is part of the BrainGenix-EVM Neuron Emulation System //
+//=================================================================//
+
+/*
+    Description: This file provides a per-request monotonic arena for parsed JSON requests.
+    Additional Notes: None
+    Date Created: 2024-05-15
+*/
+
+#pragma once
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+#include <nlohmann/json.hpp>
+
+// Internal Libraries (BG convention: use <> instead of "")
+
+
+
+namespace BG {
+namespace EVM {
+namespace Util {
+
+
+/**
+ * @brief Monotonic arena, memory is handed out from large blocks and only given back when the arena is destroyed.
+ *
+ * Each thread has a "current" arena (see ScopedRequestArena) which ArenaAllocator uses. This lets
+ * nlohmann::basic_json, which default-constructs its allocators, use an arena without any per-object state.
+ */
+class RequestArena {
+
+private:
+
+    std::vector<std::unique_ptr<char[]>> Blocks_; /**Blocks owned by the arena*/
+    char* Cursor_ = nullptr; /**Next free byte of the current block*/
+    size_t Remaining_ = 0; /**Free bytes left in the current block*/
+    size_t NextBlockSize_; /**Size of the next block, doubles every time a block is added*/
+    size_t BytesAllocated_ = 0; /**Total bytes handed out, for diagnostics*/
+
+public:
+
+    /**
+     * @brief Construct a new RequestArena object
+     *
+     * @param _InitialBlockSize Size of the first block, later blocks double in size.
+     */
+    RequestArena(size_t _InitialBlockSize = 64 * 1024);
+
+    RequestArena(const RequestArena&) = delete;
+    RequestArena& operator=(const RequestArena&) = delete;
+
+    /**
+     * @brief Returns _Size bytes aligned to alignof(std::max_align_t).
+     */
+    void* Allocate(size_t _Size);
+
+    /**
+     * @brief Returns the total number of bytes handed out so far.
+     */
+    size_t GetBytesAllocated() const;
+
+    /**
+     * @brief Returns the calling thread's current arena, or nullptr if there is none.
+     */
+    static RequestArena* Current();
+
+    /**
+     * @brief Sets the calling thread's current arena, prefer ScopedRequestArena.
+     */
+    static void SetCurrent(RequestArena* _Arena);
+
+};
+
+
+/**
+ * @brief Makes the given arena the calling thread's current arena for the lifetime of this object.
+ * Must be destroyed on the thread that created it.
+ */
+class ScopedRequestArena {
+
+private:
+
+    RequestArena* Previous_; /**Arena that was current before, restored on destruction*/
+
+public:
+
+    ScopedRequestArena(RequestArena& _Arena);
+    ~ScopedRequestArena();
+
+    ScopedRequestArena(const ScopedRequestArena&) = delete;
+    ScopedRequestArena& operator=(const ScopedRequestArena&) = delete;
+
+};
+
+
+/**
+ * @brief Stateless allocator that allocates from the calling thread's current arena, or from the heap if there is none.
+ *
+ * Every allocation carries a small header that records where it came from, so deallocation is safe
+ * from any thread: heap memory is freed, arena memory is left for its arena to release.
+ * Anything allocated from an arena must not outlive that arena.
+ */
+template <typename T> class ArenaAllocator {
+
+private:
+
+    static constexpr size_t HeaderSize_ = alignof(std::max_align_t) > sizeof(std::uint64_t) ? alignof(std::max_align_t) : sizeof(std::uint64_t);
+    static constexpr std::uint64_t FromHeap_ = 0;
+    static constexpr std::uint64_t FromArena_ = 1;
+
+public:
+
+    typedef T value_type;
+
+    ArenaAllocator() noexcept {}
+    template <typename U> ArenaAllocator(const ArenaAllocator<U>&) noexcept {}
+
+    T* allocate(size_t _Count) {
+        size_t Size = HeaderSize_ + _Count * sizeof(T);
+        RequestArena* Arena = RequestArena::Current();
+        char* Block;
+        if (Arena != nullptr) {
+            Block = static_cast<char*>(Arena->Allocate(Size));
+            *reinterpret_cast<std::uint64_t*>(Block) = FromArena_;
+        } else {
+            Block = static_cast<char*>(::operator new(Size));
+            *reinterpret_cast<std::uint64_t*>(Block) = FromHeap_;
+        }
+        return reinterpret_cast<T*>(Block + HeaderSize_);
+    }
+
+    void deallocate(T* _Pointer, size_t) noexcept {
+        char* Block = reinterpret_cast<char*>(_Pointer) - HeaderSize_;
+        if (*reinterpret_cast<std::uint64_t*>(Block) == FromHeap_) {
+            ::operator delete(Block);
+        }
+    }
+
+    template <typename U> bool operator==(const ArenaAllocator<U>&) const noexcept { return true; }
+    template <typename U> bool operator!=(const ArenaAllocator<U>&) const noexcept { return false; }
+
+};
+
+
+/**
+ * @brief JSON type used for parsed requests, its nodes are allocated from the current RequestArena.
+ * Responses keep using nlohmann::json, since they outlive the request's arena.
+ */
+typedef nlohmann::basic_json<std::map, std::vector, std::string, bool, std::int64_t, std::uint64_t, double, ArenaAllocator> ArenaJSON;
+
+
+}; // Close Namespace Util
+}; // Close Namespace EVM
+}; // Close Namespace BG
@@ -0,0 +1,140 @@
+//=================================//
+// This file is part of BrainGenix //
+//=================================//
+
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <Util/SharedMemory.h>
+
+
+
+namespace BG {
+namespace EVM {
+namespace Util {
+
+
+bool IsValidSharedMemoryName(const std::string& _Name) {
+    return _Name.size() > 1 && _Name.size() < 255 && _Name[0] == '/' && _Name.find('/', 1) == std::string::npos;
+}
+
+
+bool UnlinkSharedMemory(const std::string& _Name) {
+    return IsValidSharedMemoryName(_Name) && shm_unlink(_Name.c_str()) == 0;
+}
+
+
+SharedMemoryView::~SharedMemoryView() {
+    if (Data_ != nullptr) {
+        munmap(const_cast<void*>(Data_), Size_);
+    }
+}
+
+bool SharedMemoryView::Open(const std::string& _Name, bool _Unlink) {
+    if (Data_ != nullptr || !IsValidSharedMemoryName(_Name)) {
+        return false;
+    }
+
+    int Descriptor = shm_open(_Name.c_str(), O_RDONLY, 0);
+    if (Descriptor < 0) {
+        return false;
+    }
+
+    struct stat Status;
+    if (fstat(Descriptor, &Status) != 0 || Status.st_size <= 0) {
+        close(Descriptor);
+        return false;
+    }
+
+    void* Mapping = mmap(nullptr, size_t(Status.st_size), PROT_READ, MAP_SHARED, Descriptor, 0);
+    close(Descriptor); // The mapping keeps the segment alive
+    if (Mapping == MAP_FAILED) {
+        return false;
+    }
+
+    Data_ = Mapping;
+    Size_ = size_t(Status.st_size);
+    if (_Unlink) {
+        shm_unlink(_Name.c_str());
+    }
+    return true;
+}
+
+
+bool SharedMemoryView::MapFile(const std::string& _Path) {
+    if (Data_ != nullptr) {
+        return false;
+    }
+
+    int Descriptor = open(_Path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (Descriptor < 0) {
+        return false;
+    }
+
+    struct stat Status;
+    if (fstat(Descriptor, &Status) != 0 || !S_ISREG(Status.st_mode) || Status.st_size <= 0) {
+        close(Descriptor);
+        return false;
+    }
+
+    void* Mapping = mmap(nullptr, size_t(Status.st_size), PROT_READ, MAP_PRIVATE, Descriptor, 0);
+    close(Descriptor);
+    if (Mapping == MAP_FAILED) {
+        return false;
+    }
+
+    Data_ = Mapping;
+    Size_ = size_t(Status.st_size);
+    return true;
+}
+
+
+SharedMemorySegment::~SharedMemorySegment() {
+    if (Data_ != nullptr) {
+        munmap(Data_, Size_);
+    }
+    if (Unlink_) {
+        shm_unlink(Name_.c_str());
+    }
+}
+
+bool SharedMemorySegment::Create(const std::string& _Name, size_t _Size, bool _UnlinkOnDestroy) {
+    if (Data_ != nullptr || _Size == 0 || !IsValidSharedMemoryName(_Name)) {
+        return false;
+    }
+
+    int Descriptor = shm_open(_Name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (Descriptor < 0) {
+        return false;
+    }
+    if (ftruncate(Descriptor, off_t(_Size)) != 0) {
+        close(Descriptor);
+        shm_unlink(_Name.c_str());
+        return false;
+    }
+
+    void* Mapping = mmap(nullptr, _Size, PROT_READ | PROT_WRITE, MAP_SHARED, Descriptor, 0);
+    close(Descriptor);
+    if (Mapping == MAP_FAILED) {
+        shm_unlink(_Name.c_str());
+        return false;
+    }
+
+    Name_ = _Name;
+    Data_ = Mapping;
+    Size_ = _Size;
+    Unlink_ = _UnlinkOnDestroy;
+    return true;
+}
+
+
+}; // Close Namespace Util
+}; // Close Namespace EVM
+}; // Close Namespace BG
@@ -0,0 +1,157 @@
+//=================================================================//
+// This file is part of the BrainGenix-EVM Neuron Emulation System //
+//=================================================================//
+
+/*
+    Description: This file provides POSIX shared memory segments used to hand bulk arrays between processes on one host.
+    Additional Notes: None
+    Date Created: 2024-05-27
+*/
+
+#pragma once
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <cstddef>
+#include <string>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+
+// Internal Libraries (BG convention: use <> instead of "")
+
+
+
+namespace BG {
+namespace EVM {
+namespace Util {
+
+
+/**
+ * @brief Read-only mapping of a POSIX shared memory segment.
+ *
+ * The segment is handed over by its producer: once mapped, the name is unlinked (unless told otherwise),
+ * so the memory is released as soon as the last mapping goes away and nothing leaks if either side dies.
+ * Regular files can be mapped the same way with MapFile(), e.g. snapshots of the on-disk cache.
+ */
+class SharedMemoryView {
+
+private:
+
+    const void* Data_ = nullptr; /**Start of the mapping, nullptr if nothing is mapped*/
+    size_t Size_ = 0; /**Size of the mapping in bytes*/
+
+public:
+
+    SharedMemoryView() = default;
+
+    /**
+     * @brief Destroy the SharedMemoryView object, unmapping the segment.
+     */
+    ~SharedMemoryView();
+
+    SharedMemoryView(const SharedMemoryView&) = delete;
+    SharedMemoryView& operator=(const SharedMemoryView&) = delete;
+
+    /**
+     * @brief Maps the named segment read-only.
+     *
+     * @param _Name Segment name, must look like "/name" (a single leading slash, no others).
+     * @param _Unlink If true the name is removed once the segment is mapped.
+     * @return true on success, false if the name is invalid or the segment cannot be opened or mapped.
+     */
+    bool Open(const std::string& _Name, bool _Unlink = true);
+
+    /**
+     * @brief Maps a regular file read-only.
+     * The file may be replaced (renamed over) while mapped, the mapping keeps showing the old contents.
+     *
+     * @param _Path Path of the file.
+     * @return true on success, false if the file cannot be opened, is empty or cannot be mapped.
+     */
+    bool MapFile(const std::string& _Path);
+
+    /**
+     * @brief Start of the mapped bytes.
+     */
+    const void* Data() const {
+        return Data_;
+    }
+
+    /**
+     * @brief Number of mapped bytes.
+     */
+    size_t Size() const {
+        return Size_;
+    }
+
+};
+
+
+/**
+ * @brief Writable shared memory segment, the producing side of SharedMemoryView.
+ * Used by local stand-ins of NES, the real NES creates its segments itself.
+ */
+class SharedMemorySegment {
+
+private:
+
+    std::string Name_; /**Name of the segment*/
+    void* Data_ = nullptr; /**Start of the mapping*/
+    size_t Size_ = 0; /**Size of the mapping in bytes*/
+    bool Unlink_ = false; /**If true the name is removed on destruction (in case no reader took it over)*/
+
+public:
+
+    SharedMemorySegment() = default;
+
+    /**
+     * @brief Destroy the SharedMemorySegment object, unmapping (and optionally unlinking) the segment.
+     */
+    ~SharedMemorySegment();
+
+    SharedMemorySegment(const SharedMemorySegment&) = delete;
+    SharedMemorySegment& operator=(const SharedMemorySegment&) = delete;
+
+    /**
+     * @brief Creates a new segment of the given size, fails if the name is already taken.
+     *
+     * @param _Name Segment name, must look like "/name".
+     * @param _Size Size in bytes.
+     * @param _UnlinkOnDestroy If true the name is removed when this object is destroyed.
+     * @return true on success.
+     */
+    bool Create(const std::string& _Name, size_t _Size, bool _UnlinkOnDestroy = false);
+
+    void* Data() {
+        return Data_;
+    }
+
+    size_t Size() const {
+        return Size_;
+    }
+
+    const std::string& Name() const {
+        return Name_;
+    }
+
+};
+
+
+/**
+ * @brief Returns true if _Name is a portable POSIX shared memory name ("/name" with no other slashes).
+ */
+bool IsValidSharedMemoryName(const std::string& _Name);
+
+/**
+ * @brief Removes the name of a shared memory segment, existing mappings stay valid.
+ * Used to release segments that were handed over but could not be mapped, or were never picked up.
+ *
+ * @param _Name Segment name, must look like "/name".
+ * @return true if a segment of that name existed and was removed.
+ */
+bool UnlinkSharedMemory(const std::string& _Name);
+
+
+
+}; // Close Namespace Util
+}; // Close Namespace EVM
+}; // Close Namespace BG
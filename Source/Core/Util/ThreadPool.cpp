@@ -0,0 +1,59 @@
+// Standard Libraries (BG convention: use <> instead of "")
+#include <algorithm>
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <Util/ThreadPool.h>
+
+namespace BG {
+namespace EVM {
+namespace Util {
+
+
+ThreadPool::ThreadPool(unsigned int _NumThreads) {
+    RequestExit_ = false;
+
+    unsigned int NumThreads = _NumThreads;
+    if (NumThreads == 0) {
+        NumThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    for (unsigned int i = 0; i < NumThreads; i++) {
+        Workers_.emplace_back(&ThreadPool::WorkerThread, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> Lock(QueueMutex_);
+        RequestExit_ = true;
+    }
+    QueueCondition_.notify_all();
+    for (std::thread& Worker : Workers_) {
+        Worker.join();
+    }
+}
+
+unsigned int ThreadPool::GetNumThreads() const {
+    return Workers_.size();
+}
+
+void ThreadPool::WorkerThread() {
+    while (true) {
+        std::function<void()> Task;
+        {
+            std::unique_lock<std::mutex> Lock(QueueMutex_);
+            QueueCondition_.wait(Lock, [this]() { return RequestExit_ || !Tasks_.empty(); });
+            if (Tasks_.empty()) {
+                return; // Exit was requested and there is nothing left to do
+            }
+            Task = std::move(Tasks_.front());
+            Tasks_.pop();
+        }
+        Task();
+    }
+}
+
+
+}; // Close Namespace Util
+}; // Close Namespace EVM
+}; // Close Namespace BG
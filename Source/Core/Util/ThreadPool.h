@@ -0,0 +1,104 @@
+//=================================================================//
+// This file is part of the BrainGenix-EVM Neuron Emulation System //
+//=================================================================//
+
+/*
+    Description: This file provides a simple fixed-size worker pool.
+    Additional Notes: None
+    Date Created: 2024-05-06
+*/
+
+#pragma once
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+
+// Internal Libraries (BG convention: use <> instead of "")
+
+
+
+namespace BG {
+namespace EVM {
+namespace Util {
+
+
+/**
+ * @brief Fixed-size pool of worker threads that run queued tasks in FIFO order.
+ *
+ * Tasks are submitted with Enqueue(), which returns a future for the task's result.
+ * Any exception thrown by a task is stored in its future.
+ */
+class ThreadPool {
+
+private:
+
+    std::vector<std::thread> Workers_; /**Worker threads owned by the pool*/
+    std::queue<std::function<void()>> Tasks_; /**Tasks waiting for a free worker*/
+
+    std::mutex QueueMutex_; /**Protects Tasks_*/
+    std::condition_variable QueueCondition_; /**Signalled when a task is queued or when exiting*/
+    std::atomic_bool RequestExit_; /**Indicates if the workers are to be terminated or not*/
+
+
+    /**
+     * @brief Main loop of each worker thread.
+     */
+    void WorkerThread();
+
+public:
+
+    /**
+     * @brief Construct a new ThreadPool object
+     *
+     * @param _NumThreads Number of workers, if 0 then std::thread::hardware_concurrency() is used.
+     */
+    ThreadPool(unsigned int _NumThreads);
+
+    /**
+     * @brief Destroy the ThreadPool object
+     * Tasks that are already queued are finished before the workers are joined.
+     */
+    ~ThreadPool();
+
+
+    /**
+     * @brief Returns the number of worker threads.
+     */
+    unsigned int GetNumThreads() const;
+
+
+    /**
+     * @brief Queues the given callable and returns a future for its result.
+     *
+     * @param _Task Callable taking no arguments.
+     * @return std::future of the callable's return type.
+     */
+    template <typename F> std::future<typename std::invoke_result<F>::type> Enqueue(F _Task) {
+        typedef typename std::invoke_result<F>::type Result_t;
+        std::shared_ptr<std::packaged_task<Result_t()>> Task = std::make_shared<std::packaged_task<Result_t()>>(std::move(_Task));
+        std::future<Result_t> Future = Task->get_future();
+        {
+            std::lock_guard<std::mutex> Lock(QueueMutex_);
+            Tasks_.emplace([Task]() { (*Task)(); });
+        }
+        QueueCondition_.notify_one();
+        return Future;
+    }
+
+};
+
+
+}; // Close Namespace Util
+}; // Close Namespace EVM
+}; // Close Namespace BG
@@ -5,12 +5,18 @@
 
 // Standard Libraries (BG convention: use <> instead of "")
 #include <thread>
+#include <future>
+#include <string>
+#include <vector>
 
 // Third-Party Libraries (BG convention: use <> instead of "")
 
 // Internal Libraries (BG convention: use <> instead of "")
 #include <NESInteraction/NESSimLoad.h>
+#include <NESInteraction/NESDataCache.h>
+#include <NESInteraction/NESSimHandle.h>
 #include <PCRegistration/SimpleRegistration.h>
+#include <Metrics/N1Metrics.h>
 #include <Validation/SCValidation.h>
 
 namespace BG {
@@ -20,37 +26,79 @@ namespace BG {
  * using metrics that area suitable for a pair of emulation and
  * ground-truth systems expressed using Simple Compartmental neurons.
  * 
- * @param _Client
+ * @param _Logger Pointer to the logging system instance.
+ * @param _Router Router that places the two simulations on NES backends.
  * @param _KGTSaveName Known Ground-Truth system save name.
  * @param _EmuSaveName Emulation system save name.
  * @param _Config Configuration settings used.
+ * @param _PerNeuronResults JSON array to which the per-neuron metric records are appended.
+ * @param _Progress Optional, told about each stage as it starts.
  * @return True if successfully carried out.
  */
-bool SCVAlidate(SafeClient & _Client, const std::string & _KGTSaveName, const std::string & _EmuSaveName, const ValidationConfig & _Config) {
+bool SCVAlidate(BG::Common::Logger::LoggingSystem* _Logger, NESRouter & _Router, const std::string & _KGTSaveName, const std::string & _EmuSaveName, const ValidationConfig & _Config, nlohmann::json & _PerNeuronResults, const ValidationProgress_t & _Progress) {
 
-	Logger_->Log("Commencing validation of Simple Compartmental ground-truth and emulation systems.",1);
+	auto ReportStage = [&_Progress](const std::string& _Stage) {
+		if (_Progress) {
+			_Progress(_Stage);
+		}
+	};
 
-	// Load the specified ground-truth system.
-	int KGTSimID;
-	if (!AwaitNESSimLoad(_Client, _KGTSaveName, KGTSimID, Config.Timeout_ms)) {
-		return false;
+	_Logger->Log("Commencing validation of Simple Compartmental ground-truth and emulation systems.",1);
+
+	// Load the specified ground-truth and emulation systems at the same time.
+	// Loads are shared with concurrent validations of the same saves, and undone when the last of them releases its handle.
+	// Each simulation's data is fetched in one batch as soon as its own load is done, overlapping the other load.
+	// Only the fields that registration and the metrics below read are requested.
+	// Systems with a cached snapshot for their current fingerprint are neither loaded nor fetched, their handle stays empty.
+	const unsigned Fields = SIMPLE_REGISTRATION_FIELDS | N1Metrics::RequiredFields;
+	NESDataCache* Cache = _Router.GetDataCache();
+	NESSimManager* Sims = _Router.GetSimManager();
+	std::vector<std::string> Fingerprints(2);
+	if (Cache != nullptr) {
+		GetNESSaveFingerprints(_Logger, *_Router.Pick(), {_KGTSaveName, _EmuSaveName}, Fingerprints); // Both in one round trip
 	}
+	auto LoadAndFetch = [&](SimHandle& _Handle, const std::string& _SaveName, const std::string& _Fingerprint, SimDataset& _Data) {
+		bool Cacheable = Cache != nullptr && !_Fingerprint.empty();
+		if (Cacheable && Cache->Load(_SaveName, _Fingerprint, Fields, _Data)) {
+			_Logger->Log("Using cached data of '" + _SaveName + "', skipping its NES load", 3);
+			return true;
+		}
+		_Handle = Sims->Acquire(_SaveName, _Config.Timeout_ms);
+		if (!_Handle.IsValid()) {
+			return false;
+		}
+		if (!FetchSimDataset(_Logger, _Handle.Sim(), Fields, _Data)) {
+			return false;
+		}
+		if (Cacheable) {
+			Cache->Store(_SaveName, _Fingerprint, _Data);
+		}
+		return true;
+	};
 
-	// Load the specified emulation system.
-	int EmuSimID;
-	if (!AwaitNESSimLoad(_Client, _EmuSaveName, EmuSimID, Config.Timeout_ms)) {
+	SimHandle KGTHandle, EmuHandle;
+	SimDataset KGTData, EmuData;
+	ReportStage("LoadingKGT");
+	std::future<bool> KGTReady = std::async(std::launch::async, [&]() {
+		return LoadAndFetch(KGTHandle, _KGTSaveName, Fingerprints[0], KGTData);
+	});
+	ReportStage("LoadingEmulation");
+	bool EmuReady = LoadAndFetch(EmuHandle, _EmuSaveName, Fingerprints[1], EmuData);
+	if (!KGTReady.get() || !EmuReady) {
 		return false;
 	}
 
 	// Get a registration mapping from neurons in ground-truth to emulation.
+	ReportStage("Registration");
 	std::vector<int> KGT2Emu;
-	if (!SimpleRegistration(_Client, KGTSimID, EmuSimID, KGT2Emu)) {
+	if (!SimpleRegistration(_Logger, KGTData.SomaPositions_, EmuData.SomaPositions_, KGT2Emu)) {
 		return false;
 	}
 
 	// Apply the N1 success-criteria metrics
-	N1Metrics N1Metrics_(_Client, KGTSimID, EmuSimID, KGT2Emu);
-	if (!N1Metrics_.Validate()) {
+	ReportStage("N1Metrics");
+	N1Metrics N1Metrics_(KGTHandle.Sim(), EmuHandle.Sim(), KGTData, EmuData, KGT2Emu);
+	if (!N1Metrics_.Validate(_PerNeuronResults)) {
 		return false;
 	}
 
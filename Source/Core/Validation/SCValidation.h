@@ -11,12 +11,17 @@
 #pragma once
 
 // Standard Libraries (BG convention: use <> instead of "")
+#include <string>
+#include <functional>
 
 // Third-Party Libraries (BG convention: use <> instead of "")
-//#include <nlohmann/json.hpp>
+#include <nlohmann/json.hpp>
 
 
 // Internal Libraries (BG convention: use <> instead of "")
+#include <NESInteraction/NESRouter.h>
+
+#include <BG/Common/Logger/Logger.h>
 
 
 namespace BG {
@@ -25,17 +30,25 @@ struct ValidationConfig {
     unsigned long Timeout_ms = 100000;
 };
 
+/**
+ * Called by SCVAlidate when it enters a new stage, e.g. "LoadingKGT", "Registration".
+ */
+typedef std::function<void(const std::string& _Stage)> ValidationProgress_t;
+
 /**
  * This is a simple entry point through which to carry out validation
  * using metrics that area suitable for a pair of emulation and
  * ground-truth systems expressed using Simple Compartmental neurons.
  * 
- * @param _Client
+ * @param _Logger Pointer to the logging system instance.
+ * @param _Router Router that places the two simulations on NES backends.
  * @param _KGTSaveName Known Ground-Truth system save name.
  * @param _EmuSaveName Emulation system save name.
  * @param _Config Configuration settings used.
+ * @param _PerNeuronResults JSON array to which the per-neuron metric records are appended.
+ * @param _Progress Optional, told about each stage as it starts.
  * @return True if successfully carried out.
  */
-bool SCVAlidate(SafeClient & _Client, const std::string & _KGTSaveName, const std::string & _EmuSaveName, const ValidationConfig & _Config);
+bool SCVAlidate(BG::Common::Logger::LoggingSystem* _Logger, NESRouter & _Router, const std::string & _KGTSaveName, const std::string & _EmuSaveName, const ValidationConfig & _Config, nlohmann::json & _PerNeuronResults, const ValidationProgress_t & _Progress = ValidationProgress_t());
 
 } // BG
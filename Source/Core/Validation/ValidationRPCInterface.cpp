@@ -1,4 +1,5 @@
 #include <Validation/ValidationRPCInterface.h>
+#include <Validation/SCValidation.h>
 #include <RPC/APIStatusCode.h>
 
 
@@ -9,22 +10,120 @@
 
 namespace BG {
 
-ValidationRPCInterface::ValidationRPCInterface(BG::Common::Logger::LoggingSystem* _Logger, API::RPCManager* _RPCManager) {
+ValidationRPCInterface::ValidationRPCInterface(BG::Common::Logger::LoggingSystem* _Logger, EVM::API::RPCManager* _RPCManager) {
     assert(_Logger != nullptr);
     assert(_RPCManager != nullptr);
 
     Logger_ = _Logger;
+    Manager_ = _RPCManager;
+    Router_ = _RPCManager->GetNESRouter();
+    Events_ = _RPCManager->GetEventPublisher();
+    Results_ = std::make_unique<EVM::API::ResultStore>(_RPCManager->GetConfig()->ResultStoreMaxResults, _RPCManager->GetConfig()->ResultStoreTTL_ms);
+    NextJobID_ = 0;
 
     // Register Callbacks
-    _RPCManager->AddRoute("Validation/SCValidation", std::bind(&ValidationRPCInterface::SCValidation, this, std::placeholders::_1));
+    EVM::API::ParamSchema<SCValidationParams> SCValidationSchema;
+    SCValidationSchema.String("KGTSaveName", &SCValidationParams::KGTSaveName)
+                      .String("EmuSaveName", &SCValidationParams::EmuSaveName)
+                      .Int("Timeout_ms", &SCValidationParams::Timeout_ms, false)
+                      .String("JobID", &SCValidationParams::JobID, false)
+                      .Bool("Async", &SCValidationParams::Async, false);
+
+    EVM::API::ParamSchema<ResultPageParams> ResultPageSchema;
+    ResultPageSchema.Int("ResultHandle", &ResultPageParams::ResultHandle)
+                    .Int("Cursor", &ResultPageParams::Cursor, false)
+                    .Int("PageSize", &ResultPageParams::PageSize, false);
+
+    EVM::API::ParamSchema<ReleaseResultParams> ReleaseResultSchema;
+    ReleaseResultSchema.Int("ResultHandle", &ReleaseResultParams::ResultHandle);
+
+    // Validation runs take seconds, so they are capped as heavy, callers that must not wait use "Async"
+    _RPCManager->AddSchemaRoute<SCValidationParams>("Validation/SCValidation", SCValidationSchema, std::bind(&ValidationRPCInterface::SCValidation, this, std::placeholders::_1), EVM::API::ROUTE_HEAVY);
+    _RPCManager->AddSchemaRoute<ResultPageParams>("Validation/GetResultPage", ResultPageSchema, std::bind(&ValidationRPCInterface::GetResultPage, this, std::placeholders::_1));
+    _RPCManager->AddSchemaRoute<ReleaseResultParams>("Validation/ReleaseResult", ReleaseResultSchema, std::bind(&ValidationRPCInterface::ReleaseResult, this, std::placeholders::_1));
 
 }
 
 ValidationRPCInterface::~ValidationRPCInterface() {
+    std::unique_lock<std::mutex> Lock(JobsMutex_);
+    JobsCondition_.wait(Lock, [this]() { return RunningJobs_ == 0; });
+}
+
+nlohmann::json ValidationRPCInterface::SCValidation(SCValidationParams& _Params) {
+
+    std::string JobID = _Params.JobID;
+    if (JobID.empty()) {
+        JobID = "SCValidation-" + std::to_string(NextJobID_++);
+    }
+
+    if (!_Params.Async) {
+        nlohmann::json ResponseJSON = RunSCValidation(_Params, JobID);
+        ResponseJSON["JobID"] = JobID;
+        return ResponseJSON;
+    }
+
+    // The caller gets the JobID now and the result through the completion event
+    {
+        std::lock_guard<std::mutex> Lock(JobsMutex_);
+        RunningJobs_++;
+    }
+    Manager_->SubmitBackground([this, Params = _Params, JobID]() {
+        RunSCValidation(Params, JobID);
+        {
+            std::lock_guard<std::mutex> Lock(JobsMutex_);
+            RunningJobs_--;
+        }
+        JobsCondition_.notify_all();
+    });
+
+    nlohmann::json ResponseJSON;
+    ResponseJSON["StatusCode"] = int(EVM::API::BGStatusCode::BGStatusSuccess);
+    ResponseJSON["JobID"] = JobID;
+    return ResponseJSON;
+}
+
+nlohmann::json ValidationRPCInterface::RunSCValidation(const SCValidationParams& _Params, const std::string& _JobID) {
+
+    ValidationConfig Config;
+    if (_Params.Timeout_ms >= 0) {
+        Config.Timeout_ms = _Params.Timeout_ms;
+    }
+
+    ValidationProgress_t Progress = [this, &_JobID](const std::string& _Stage) {
+        nlohmann::json Event;
+        Event["Stage"] = _Stage;
+        Events_->Publish(_JobID, EVM::API::JOB_EVENT_PROGRESS, std::move(Event));
+    };
+
+    nlohmann::json ResponseJSON;
+
+    // The per-neuron table can get very large, so it is kept here and read out with Validation/GetResultPage
+    nlohmann::json PerNeuronResults = nlohmann::json::array();
+    if (!SCVAlidate(Logger_, *Router_, _Params.KGTSaveName, _Params.EmuSaveName, Config, PerNeuronResults, Progress)) {
+        ResponseJSON["StatusCode"] = int(EVM::API::BGStatusCode::BGStatusGeneralFailure);
+    } else {
+        ResponseJSON["StatusCode"] = int(EVM::API::BGStatusCode::BGStatusSuccess);
+        ResponseJSON["TotalItems"] = PerNeuronResults.size();
+        ResponseJSON["ResultHandle"] = Results_->Store(std::move(PerNeuronResults));
+    }
+
+    Events_->Publish(_JobID, EVM::API::JOB_EVENT_COMPLETED, ResponseJSON);
+    return ResponseJSON;
+}
+
+nlohmann::json ValidationRPCInterface::GetResultPage(ResultPageParams& _Params) {
+    return Results_->GetPage(_Params.ResultHandle, _Params.Cursor, _Params.PageSize);
 }
 
-std::string ValidationRPCInterface::SCValidation(std::string _JSONRequest) {
-    
+nlohmann::json ValidationRPCInterface::ReleaseResult(ReleaseResultParams& _Params) {
+    nlohmann::json ResponseJSON;
+    ResponseJSON["ResultHandle"] = _Params.ResultHandle;
+    if (Results_->Release(_Params.ResultHandle)) {
+        ResponseJSON["StatusCode"] = int(EVM::API::BGStatusCode::BGStatusSuccess);
+    } else {
+        ResponseJSON["StatusCode"] = int(EVM::API::BGStatusCode::BGStatusInvalidParametersPassed);
+    }
+    return ResponseJSON;
 }
 
 } // BG
@@ -12,9 +12,11 @@
 
 // Standard Libraries (BG convention: use <> instead of "")
 #include <atomic>
+#include <memory>
 #include <thread>
 #include <mutex>
 #include <chrono>
+#include <condition_variable>
 #include <assert.h>
 
 // Third-Party Libraries (BG convention: use <> instead of "")
@@ -23,12 +25,47 @@
 // Internal Libraries (BG convention: use <> instead of "")
 #include <RPC/RPCManager.h>
 #include <RPC/RPCHandlerHelper.h>
+#include <RPC/ResultStore.h>
+#include <RPC/EventPublisher.h>
+#include <RPC/SafeClient.h>
+#include <NESInteraction/NESRouter.h>
 
 #include <BG/Common/Logger/Logger.h>
 
 
 namespace BG {
 
+#define DEFAULT_RESULT_PAGE_SIZE 1000
+
+
+/**
+ * @brief Decoded parameters of Validation/SCValidation.
+ */
+struct SCValidationParams {
+    std::string KGTSaveName;    /**Known ground-truth system save name*/
+    std::string EmuSaveName;    /**Emulation system save name*/
+    int Timeout_ms = -1;        /**Optional, -1 keeps the ValidationConfig default*/
+    std::string JobID;          /**Optional, identifies the job in pushed events, generated if empty*/
+    bool Async = false;         /**Optional, if true the call returns right away and the result only arrives as a completion event*/
+};
+
+/**
+ * @brief Decoded parameters of Validation/GetResultPage.
+ */
+struct ResultPageParams {
+    int ResultHandle = -1;                      /**Handle returned with the result*/
+    int Cursor = 0;                             /**Optional, index of the first item of the page*/
+    int PageSize = DEFAULT_RESULT_PAGE_SIZE;    /**Optional, maximum number of items in the page*/
+};
+
+/**
+ * @brief Decoded parameters of Validation/ReleaseResult.
+ */
+struct ReleaseResultParams {
+    int ResultHandle = -1;                      /**Handle returned with the result*/
+};
+
+
 /**
  * @brief This class provides the infrastructure to run simulations.
  */
@@ -37,6 +74,27 @@ class ValidationRPCInterface {
 private:
 
     BG::Common::Logger::LoggingSystem* Logger_ = nullptr; /**Pointer to the instance of the logging system*/
+    NESRouter* Router_ = nullptr; /**Places the simulations of each run on NES backends*/
+
+    EVM::API::RPCManager* Manager_ = nullptr; /**Runs asynchronous jobs on its compute pool*/
+    EVM::API::EventPublisher* Events_ = nullptr; /**Pushes progress and completion events to the API service*/
+
+    std::unique_ptr<EVM::API::ResultStore> Results_; /**Large validation results, read out with Validation/GetResultPage*/
+
+    std::atomic<int> NextJobID_; /**Used to generate JobIDs when the caller did not give one*/
+    std::mutex JobsMutex_; /**Protects RunningJobs_*/
+    std::condition_variable JobsCondition_; /**Signalled when an asynchronous job finishes*/
+    int RunningJobs_ = 0; /**Asynchronous jobs still running, the destructor waits for them*/
+
+
+    /**
+     * @brief Runs a validation, stores its result and publishes the job's progress and completion events.
+     * 
+     * @param _Params 
+     * @param _JobID 
+     * @return nlohmann::json Response with StatusCode, and ResultHandle and TotalItems on success.
+     */
+    nlohmann::json RunSCValidation(const SCValidationParams& _Params, const std::string& _JobID);
 
 
 public:
@@ -49,17 +107,42 @@ public:
      * @param _Config 
      * @param _RPCManager
      */
-    ValidationRPCInterface(BG::Common::Logger::LoggingSystem* _Logger, API::RPCManager* _RPCManager);
+    ValidationRPCInterface(BG::Common::Logger::LoggingSystem* _Logger, EVM::API::RPCManager* _RPCManager);
 
-    ~ModelRPCInterface();
+    /**
+     * @brief Destroy the Interface object
+     * Waits for asynchronous validations that are still running.
+     */
+    ~ValidationRPCInterface();
 
     /**
      * @brief Various routes for API
+     * The response always carries the JobID used in the pushed events. With "Async" the response only
+     * has StatusCode and JobID, the rest follows in the job's completion event.
+     * 
+     * @param _Params 
+     * @return nlohmann::json 
+     */
+    nlohmann::json SCValidation(SCValidationParams& _Params);
+
+    /**
+     * @brief Returns one page of a stored result.
+     * Expects "ResultHandle" and optionally "Cursor" (default 0) and "PageSize" (default DEFAULT_RESULT_PAGE_SIZE).
+     * The response's "NextCursor" is the cursor of the next page, or -1 after the last one.
+     * 
+     * @param _Params 
+     * @return nlohmann::json 
+     */
+    nlohmann::json GetResultPage(ResultPageParams& _Params);
+
+    /**
+     * @brief Drops a stored result once the caller has read it.
+     * Results that are never released expire after the configured time to live.
      * 
-     * @param _JSONRequest 
-     * @return std::string 
+     * @param _Params 
+     * @return nlohmann::json 
      */
-    std::string SCValidation(std::string _JSONRequest);
+    nlohmann::json ReleaseResult(ReleaseResultParams& _Params);
 
 };
 
@@ -0,0 +1,103 @@
+//=================================//
+// This file is part of BrainGenix //
+//=================================//
+
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <iostream>
+#include <stdexcept>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <EmulatorConfig.h>
+
+
+
+namespace BG {
+namespace NESEmulator {
+
+
+static void PrintUsage(const char* _Program) {
+    std::cout << "Usage: " << _Program << " [--Option Value]...\n"
+              << "  --Host <addr>                  Listen address (default 0.0.0.0)\n"
+              << "  --Port <port>                  Listen port (default 8001)\n"
+              << "  --Threads <n>                  Server worker threads (default 4)\n"
+              << "  --DefaultNeurons <n>           Network size if the save name does not give one (default 1000)\n"
+              << "  --Seed <n>                     Changes every synthetic network (default 0)\n"
+              << "  --Latency_ms <ms>              Fixed delay per reply (default 0)\n"
+              << "  --Jitter_ms <ms>               Random extra delay per reply, up to this (default 0)\n"
+              << "  --Bandwidth_Mbps <mbps>        Simulated link speed, 0 = unlimited (default 0)\n"
+              << "  --LoadTimePerNeuron_ms <ms>    Time a load stays busy per neuron (default 0.01)\n"
+              << "  --SegmentTTL_ms <ms>           Removes shared memory segments not picked up by then (default 60000)\n"
+              << "  --CompletionCallback <h:p>     EVM to notify through 'NESCompleted' when a load finishes (default none)\n"
+              << "  --BackendName <h:p>            This server's entry in the EVM's NES_Backends, sent with completions (default <Host>:<Port>)\n"
+              << "Save names of the form 'synthetic-<Neurons>[-<Tag>]' load a network of that size.\n";
+}
+
+
+bool ParseArguments(int _NumArguments, char** _ArgumentValues, EmulatorConfig& _Config) {
+
+    for (int i = 1; i < _NumArguments; i++) {
+        std::string Name = _ArgumentValues[i];
+        if (Name == "--help" || Name == "-h") {
+            PrintUsage(_ArgumentValues[0]);
+            return false;
+        }
+        if (i + 1 >= _NumArguments) {
+            std::cerr << "Missing value for '" << Name << "'\n";
+            PrintUsage(_ArgumentValues[0]);
+            return false;
+        }
+        std::string Value = _ArgumentValues[++i];
+
+        try {
+            if (Name == "--Host") {
+                _Config.Host = Value;
+            } else if (Name == "--Port") {
+                _Config.Port = std::stoi(Value);
+            } else if (Name == "--Threads") {
+                _Config.Threads = std::stoi(Value);
+            } else if (Name == "--DefaultNeurons") {
+                _Config.DefaultNeurons = std::stoi(Value);
+            } else if (Name == "--Seed") {
+                _Config.Seed = static_cast<unsigned int>(std::stoul(Value));
+            } else if (Name == "--Latency_ms") {
+                _Config.Latency_ms = std::stoi(Value);
+            } else if (Name == "--Jitter_ms") {
+                _Config.Jitter_ms = std::stoi(Value);
+            } else if (Name == "--Bandwidth_Mbps") {
+                _Config.Bandwidth_Mbps = std::stod(Value);
+            } else if (Name == "--LoadTimePerNeuron_ms") {
+                _Config.LoadTimePerNeuron_ms = std::stod(Value);
+            } else if (Name == "--SegmentTTL_ms") {
+                _Config.SegmentTTL_ms = std::stoi(Value);
+            } else if (Name == "--CompletionCallback") {
+                _Config.CompletionCallback = Value;
+            } else if (Name == "--BackendName") {
+                _Config.BackendName = Value;
+            } else {
+                std::cerr << "Unknown option '" << Name << "'\n";
+                PrintUsage(_ArgumentValues[0]);
+                return false;
+            }
+        } catch (std::exception& e) {
+            std::cerr << "Invalid value '" << Value << "' for '" << Name << "'\n";
+            return false;
+        }
+    }
+
+    if (_Config.Threads < 1 || _Config.DefaultNeurons < 0 || _Config.Latency_ms < 0 || _Config.Jitter_ms < 0 || _Config.SegmentTTL_ms < 0) {
+        std::cerr << "Threads must be at least 1, sizes and delays must not be negative\n";
+        return false;
+    }
+    if (!_Config.CompletionCallback.empty() && _Config.CompletionCallback.rfind(':') == std::string::npos) {
+        std::cerr << "CompletionCallback must look like host:port\n";
+        return false;
+    }
+    return true;
+}
+
+
+}; // Close Namespace NESEmulator
+}; // Close Namespace BG
@@ -0,0 +1,63 @@
+//=================================================================//
+// This file is part of the BrainGenix-EVM Neuron Emulation System //
+//=================================================================//
+
+/*
+    Description: This file provides the settings of the NES stand-in server and their command line parsing.
+    Additional Notes: None
+    Date Created: 2024-05-28
+*/
+
+#pragma once
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <string>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+
+// Internal Libraries (BG convention: use <> instead of "")
+
+
+
+namespace BG {
+namespace NESEmulator {
+
+
+/**
+ * @brief Settings of the stand-in server, all can be given on the command line (see ParseArguments()).
+ */
+struct EmulatorConfig {
+
+    std::string Host = "0.0.0.0";   /**Address the server listens on*/
+    int Port = 8001;                /**Port the server listens on, point NES_Backends (or the API callback) here*/
+    int Threads = 4;                /**Number of rpclib worker threads*/
+
+    int DefaultNeurons = 1000;      /**Size of synthetic networks whose save name does not give one*/
+    unsigned int Seed = 0;          /**Mixed into every network's seed, change to get different networks for the same names*/
+
+    int Latency_ms = 0;             /**Fixed delay added to every reply*/
+    int Jitter_ms = 0;              /**Uniform random delay of up to this much added on top of Latency_ms*/
+    double Bandwidth_Mbps = 0.0;    /**Simulated link speed, replies are delayed by their size over this, 0 = unlimited*/
+    double LoadTimePerNeuron_ms = 0.01; /**Time a Simulation/Load stays busy per neuron of the network*/
+    int SegmentTTL_ms = 60000;      /**Shared memory segments no reader unlinked within this time are removed by the server*/
+
+    std::string CompletionCallback = ""; /**"host:port" of the EVM to call ("NESCompleted") when a load finishes, empty = none*/
+    std::string BackendName = "";   /**"host:port" the EVM knows this server by (its NES_Backends entry), sent with completions, empty = "<Host>:<Port>"*/
+
+};
+
+
+/**
+ * @brief Fills the config from arguments of the form "--Name Value", e.g. "--Port 8001 --Latency_ms 2".
+ * The names are those of the EmulatorConfig fields. Prints usage and returns false on "--help" or bad input.
+ * 
+ * @param _NumArguments 
+ * @param _ArgumentValues 
+ * @param _Config 
+ * @return true if the server should be started.
+ */
+bool ParseArguments(int _NumArguments, char** _ArgumentValues, EmulatorConfig& _Config);
+
+
+}; // Close Namespace NESEmulator
+}; // Close Namespace BG
@@ -0,0 +1,362 @@
+//=================================//
+// This file is part of BrainGenix //
+//=================================//
+
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <cstring>
+#include <random>
+#include <thread>
+#include <unistd.h>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <EmulatorServer.h>
+
+#include <RPC/APIStatusCode.h>
+#include <Util/SharedMemory.h>
+
+#include <Version.h>
+
+
+
+namespace BG {
+namespace NESEmulator {
+
+
+EmulatorServer::EmulatorServer(const EmulatorConfig& _Config, BG::Common::Logger::LoggingSystem* _Logger) {
+    Config_ = _Config;
+    Logger_ = _Logger;
+    NextSegment_ = 0;
+    EventsReceived_ = 0;
+
+    Server_ = std::make_unique<rpc::server>(Config_.Host, Config_.Port);
+
+    Server_->bind("GetAPIVersion", [this]() {
+        Delay(std::strlen(VERSION));
+        return std::string(VERSION);
+    });
+    AddRoute("", [this](const std::string&) { return GetStatus(); });
+    AddRoute("Echo", [this](const std::string& _Request) { return HandleBatch(_Request); });
+    AddRoute("Simulation/Load", [this](const std::string& _Request) { return HandleBatch(_Request); });
+    AddRoute("Simulation/GetSomaPositions", [this](const std::string& _Request) { return HandleBatch(_Request); });
+    AddRoute("Simulation/GetSaveFingerprint", [this](const std::string& _Request) { return HandleBatch(_Request); });
+    AddRoute("Simulation/Unload", [this](const std::string& _Request) { return HandleBatch(_Request); });
+    AddRoute("NES", [this](const std::string& _Request) { return HandleBatch(_Request); });
+    AddRoute("EVM/PushEvents", [this](const std::string& _Request) { return PushEvents(_Request); });
+
+    if (!Config_.CompletionCallback.empty()) {
+        CallbackThread_ = std::thread(&EmulatorServer::CallbackThread, this);
+    }
+
+    Server_->async_run(Config_.Threads);
+    Logger_->Log("NES Emulator Listening On " + Config_.Host + ":" + std::to_string(Config_.Port) + " With " + std::to_string(Config_.Threads) + " Threads", 5);
+}
+
+EmulatorServer::~EmulatorServer() {
+    Server_->stop();
+    ReapSegments(true);
+    if (CallbackThread_.joinable()) {
+        {
+            std::lock_guard<std::mutex> Lock(CallbackMutex_);
+            StopCallbacks_ = true;
+        }
+        CallbackCondition_.notify_all();
+        CallbackThread_.join();
+    }
+    Logger_->Log("NES Emulator Stopped, Received " + std::to_string(EventsReceived_.load()) + " Job Events", 5);
+}
+
+
+void EmulatorServer::AddRoute(const std::string& _Route, std::function<std::string(const std::string&)> _Handler) {
+    Server_->bind(_Route, [this, _Handler](std::string _Request) {
+        std::string Reply = _Handler(_Request);
+        Delay(Reply.size());
+        return Reply;
+    });
+}
+
+
+void EmulatorServer::Delay(size_t _ReplyBytes) {
+    thread_local std::mt19937 Random(std::random_device{}());
+
+    double Delay_ms = Config_.Latency_ms;
+    if (Config_.Jitter_ms > 0) {
+        Delay_ms += std::uniform_real_distribution<double>(0.0, Config_.Jitter_ms)(Random);
+    }
+    if (Config_.Bandwidth_Mbps > 0.0) {
+        Delay_ms += (_ReplyBytes * 8.0) / (Config_.Bandwidth_Mbps * 1000.0);
+    }
+    if (Delay_ms > 0.0) {
+        std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(Delay_ms));
+    }
+}
+
+
+std::string EmulatorServer::HandleBatch(const std::string& _Request) {
+
+    nlohmann::json Requests = nlohmann::json::parse(_Request, nullptr, false);
+    if (Requests.is_discarded() || !Requests.is_array()) {
+        nlohmann::json Error;
+        Error["StatusCode"] = EVM::API::BGStatusInvalidParametersPassed;
+        return Error.dump();
+    }
+
+    // Each request is {"ReqID": <id>, "<Name>": <params>}
+    nlohmann::json Responses = nlohmann::json::array();
+    for (const nlohmann::json& Request : Requests) {
+        nlohmann::json Response;
+        Response["StatusCode"] = EVM::API::BGStatusInvalidParametersPassed;
+        if (Request.is_object()) {
+            for (auto Field = Request.begin(); Field != Request.end(); ++Field) {
+                if (Field.key() != "ReqID") {
+                    Response = HandleRequest(Field.key(), Field.value());
+                    break;
+                }
+            }
+        }
+        Response["ReqID"] = Request.is_object() && Request.contains("ReqID") ? Request["ReqID"] : nlohmann::json(-1);
+        Responses.push_back(std::move(Response));
+    }
+    return Responses.dump();
+}
+
+
+nlohmann::json EmulatorServer::HandleRequest(const std::string& _Name, const nlohmann::json& _Params) {
+    if (_Name == "Simulation/Load") {
+        return Load(_Params);
+    }
+    if (_Name == "Simulation/GetSomaPositions") {
+        return GetSomaPositions(_Params);
+    }
+    if (_Name == "Simulation/GetSaveFingerprint") {
+        return GetSaveFingerprint(_Params);
+    }
+    if (_Name == "Simulation/Unload") {
+        return Unload(_Params);
+    }
+    nlohmann::json Response;
+    if (_Name == "Echo") {
+        Response["StatusCode"] = EVM::API::BGStatusSuccess;
+        Response["Echo"] = _Params;
+        return Response;
+    }
+    Logger_->Log("NES Emulator Does Not Know Request '" + _Name + "'", 6);
+    Response["StatusCode"] = EVM::API::BGStatusInvalidParametersPassed;
+    return Response;
+}
+
+
+nlohmann::json EmulatorServer::Load(const nlohmann::json& _Params) {
+    nlohmann::json Response;
+    if (!_Params.is_object() || !_Params.contains("SavedSimName") || !_Params["SavedSimName"].is_string()) {
+        Response["StatusCode"] = EVM::API::BGStatusInvalidParametersPassed;
+        return Response;
+    }
+
+    std::shared_ptr<SyntheticNetwork> Network = std::make_shared<SyntheticNetwork>();
+    MakeSyntheticNetwork(_Params["SavedSimName"].get<std::string>(), Config_, *Network);
+
+    Simulation Sim;
+    Sim.ReadyAt_ = std::chrono::steady_clock::now()
+        + std::chrono::microseconds(static_cast<std::int64_t>(Network->NumNeurons() * Config_.LoadTimePerNeuron_ms * 1000.0));
+    std::chrono::steady_clock::time_point ReadyAt = Sim.ReadyAt_;
+    Sim.Network_ = std::move(Network);
+
+    int SimID;
+    {
+        std::lock_guard<std::mutex> Lock(SimsMutex_);
+        SimID = NextSimID_++;
+        Sims_[SimID] = std::move(Sim);
+    }
+    Logger_->Log("Loaded Synthetic Network '" + _Params["SavedSimName"].get<std::string>() + "' As Simulation " + std::to_string(SimID), 2);
+
+    if (!Config_.CompletionCallback.empty()) {
+        {
+            std::lock_guard<std::mutex> Lock(CallbackMutex_);
+            PendingCompletions_.emplace(ReadyAt, SimID);
+        }
+        CallbackCondition_.notify_all();
+    }
+
+    Response["StatusCode"] = EVM::API::BGStatusSuccess;
+    Response["SimulationID"] = SimID;
+    return Response;
+}
+
+
+nlohmann::json EmulatorServer::Unload(const nlohmann::json& _Params) {
+    nlohmann::json Response;
+    if (!_Params.is_object() || !_Params.contains("SimID") || !_Params["SimID"].is_number_integer()) {
+        Response["StatusCode"] = EVM::API::BGStatusInvalidParametersPassed;
+        return Response;
+    }
+
+    // Replies still being built keep their network alive through the shared pointer
+    int SimID = _Params["SimID"].get<int>();
+    size_t Removed;
+    {
+        std::lock_guard<std::mutex> Lock(SimsMutex_);
+        Removed = Sims_.erase(SimID);
+    }
+    if (Removed == 0) {
+        Response["StatusCode"] = EVM::API::BGStatusInvalidParametersPassed;
+        return Response;
+    }
+    Logger_->Log("Unloaded Simulation " + std::to_string(SimID), 2);
+    Response["StatusCode"] = EVM::API::BGStatusSuccess;
+    return Response;
+}
+
+
+nlohmann::json EmulatorServer::GetSaveFingerprint(const nlohmann::json& _Params) {
+    nlohmann::json Response;
+    if (!_Params.is_object() || !_Params.contains("SavedSimName") || !_Params["SavedSimName"].is_string()) {
+        Response["StatusCode"] = EVM::API::BGStatusInvalidParametersPassed;
+        return Response;
+    }
+    Response["StatusCode"] = EVM::API::BGStatusSuccess;
+    Response["Fingerprint"] = GetSyntheticFingerprint(_Params["SavedSimName"].get<std::string>(), Config_);
+    return Response;
+}
+
+
+nlohmann::json EmulatorServer::GetSomaPositions(const nlohmann::json& _Params) {
+    nlohmann::json Response;
+    if (!_Params.is_object() || !_Params.contains("SimID") || !_Params["SimID"].is_number_integer()) {
+        Response["StatusCode"] = EVM::API::BGStatusInvalidParametersPassed;
+        return Response;
+    }
+
+    std::shared_ptr<const SyntheticNetwork> Network;
+    {
+        std::lock_guard<std::mutex> Lock(SimsMutex_);
+        auto Sim = Sims_.find(_Params["SimID"].get<int>());
+        if (Sim == Sims_.end()) {
+            Response["StatusCode"] = EVM::API::BGStatusInvalidParametersPassed;
+            return Response;
+        }
+        if (std::chrono::steady_clock::now() < Sim->second.ReadyAt_) {
+            Response["StatusCode"] = EVM::API::BGStatusSimulationBusy;
+            return Response;
+        }
+        Network = Sim->second.Network_;
+    }
+
+    // Same-host readers can take the array from a shared memory segment, the reader unlinks it
+    const std::vector<float>& Positions = Network->SomaPositions_;
+    if (_Params.value("BulkTransport", "") == "SHM" && !Positions.empty()) {
+        ReapSegments(false);
+        std::string Name = "/bgnes-" + std::to_string(getpid()) + "-" + std::to_string(NextSegment_++);
+        EVM::Util::SharedMemorySegment Segment;
+        if (Segment.Create(Name, Positions.size() * sizeof(float), false)) {
+            std::memcpy(Segment.Data(), Positions.data(), Positions.size() * sizeof(float));
+            {
+                std::lock_guard<std::mutex> Lock(SegmentsMutex_);
+                Segments_.emplace_back(std::chrono::steady_clock::now(), Name);
+            }
+            nlohmann::json Descriptor;
+            Descriptor["SHMName"] = Name;
+            Descriptor["Offset"] = 0;
+            Descriptor["Count"] = Positions.size();
+            Descriptor["DType"] = "float32";
+            Response["StatusCode"] = EVM::API::BGStatusSuccess;
+            Response["SomaPositions"] = std::move(Descriptor);
+            return Response;
+        }
+        Logger_->Log("Failed To Create Shared Memory Segment '" + Name + "', Sending Inline", 6);
+    }
+
+    Response["StatusCode"] = EVM::API::BGStatusSuccess;
+    Response["SomaPositions"] = Positions;
+    return Response;
+}
+
+
+void EmulatorServer::ReapSegments(bool _All) {
+    std::chrono::steady_clock::time_point Expired = std::chrono::steady_clock::now() - std::chrono::milliseconds(Config_.SegmentTTL_ms);
+    std::lock_guard<std::mutex> Lock(SegmentsMutex_);
+    while (!Segments_.empty() && (_All || Segments_.front().first <= Expired)) {
+        if (EVM::Util::UnlinkSharedMemory(Segments_.front().second)) {
+            Logger_->Log("Removed Shared Memory Segment '" + Segments_.front().second + "' That Was Never Picked Up", 4);
+        }
+        Segments_.pop_front();
+    }
+}
+
+
+void EmulatorServer::CallbackThread() {
+
+    size_t Separator = Config_.CompletionCallback.rfind(':');
+    std::string Host = Config_.CompletionCallback.substr(0, Separator);
+    int Port = std::stoi(Config_.CompletionCallback.substr(Separator + 1));
+    std::string BackendName = Config_.BackendName.empty() ? Config_.Host + ":" + std::to_string(Config_.Port) : Config_.BackendName;
+    std::unique_ptr<rpc::client> Client;
+
+    std::unique_lock<std::mutex> Lock(CallbackMutex_);
+    while (!StopCallbacks_) {
+        if (PendingCompletions_.empty()) {
+            CallbackCondition_.wait(Lock);
+            continue;
+        }
+        auto Next = PendingCompletions_.begin();
+        if (std::chrono::steady_clock::now() < Next->first) {
+            CallbackCondition_.wait_until(Lock, Next->first);
+            continue;
+        }
+        int SimID = Next->second;
+        PendingCompletions_.erase(Next);
+
+        // Calls are made without the lock, so loads can be queued meanwhile
+        Lock.unlock();
+        nlohmann::json Completion;
+        Completion["StatusCode"] = EVM::API::BGStatusSuccess;
+        Completion["SimulationID"] = SimID;
+        Completion["Backend"] = BackendName;
+        try {
+            if (!Client) {
+                Client = std::make_unique<rpc::client>(Host, Port);
+                Client->set_timeout(1000);
+            }
+            Client->call("NESCompleted", Completion.dump());
+        } catch (std::exception& e) {
+            Logger_->Log("Failed To Report Completion To '" + Config_.CompletionCallback + "': " + e.what(), 6);
+            Client.reset();
+        }
+        Lock.lock();
+    }
+}
+
+
+std::string EmulatorServer::GetStatus() {
+    nlohmann::json Response;
+    Response["StatusCode"] = EVM::API::BGStatusSuccess;
+
+    std::chrono::steady_clock::time_point Now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> Lock(SimsMutex_);
+    for (const std::pair<const int, Simulation>& Sim : Sims_) {
+        if (Now < Sim.second.ReadyAt_) {
+            Response["StatusCode"] = EVM::API::BGStatusSimulationBusy;
+            break;
+        }
+    }
+    return Response.dump();
+}
+
+
+std::string EmulatorServer::PushEvents(const std::string& _Request) {
+    nlohmann::json Request = nlohmann::json::parse(_Request, nullptr, false);
+    nlohmann::json Response;
+    if (Request.is_discarded() || !Request.contains("Events") || !Request["Events"].is_array()) {
+        Response["StatusCode"] = EVM::API::BGStatusInvalidParametersPassed;
+        return Response.dump();
+    }
+    EventsReceived_ += Request["Events"].size();
+    Response["StatusCode"] = EVM::API::BGStatusSuccess;
+    return Response.dump();
+}
+
+
+}; // Close Namespace NESEmulator
+}; // Close Namespace BG
@@ -0,0 +1,142 @@
+//=================================================================//
+// This file is part of the BrainGenix-EVM Neuron Emulation System //
+//=================================================================//
+
+/*
+    Description: This file provides an rpclib server that stands in for NES, so EVM can be benchmarked offline.
+    Additional Notes: None
+    Date Created: 2024-05-28
+*/
+
+#pragma once
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+#include <rpc/server.h>
+#include <rpc/client.h>
+#include <nlohmann/json.hpp>
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <BG/Common/Logger/Logger.h>
+
+#include <EmulatorConfig.h>
+#include <SyntheticNetwork.h>
+
+
+
+namespace BG {
+namespace NESEmulator {
+
+
+/**
+ * @brief Serves the NES routes EVM uses from synthetic networks, with configurable latency and bandwidth.
+ *
+ * Routes:
+ *   "GetAPIVersion"                 Returns the version EVM was built with, so EVM's version check passes.
+ *   ""                              Status, {"StatusCode": 5} while any load is still busy, else 0.
+ *   "Echo", "Simulation/Load",
+ *   "Simulation/GetSomaPositions",
+ *   "Simulation/GetSaveFingerprint",
+ *   "Simulation/Unload",
+ *   "NES"                           Batches of the form [{"ReqID": 0, "<Request>": {...}}, ...], answered in order.
+ *   "EVM/PushEvents"                Accepts job event batches, so the server can also be EVM's API callback.
+ *
+ * Soma positions are sent inline, or as a shared memory segment if the request asks for "BulkTransport": "SHM"
+ * (see Util::DecodeBulkArray() on the EVM side). Segments nobody picked up are removed after SegmentTTL_ms and on shutdown. Every reply is delayed by the configured latency, jitter and
+ * its size over the configured bandwidth.
+ *
+ * If a completion callback is configured, "NESCompleted" is called on that EVM whenever a load finishes.
+ */
+class EmulatorServer {
+
+private:
+
+    /**
+     * @brief A loaded simulation.
+     */
+    struct Simulation {
+        std::shared_ptr<const SyntheticNetwork> Network_; /**Shared so replies can be built without holding the lock*/
+        std::chrono::steady_clock::time_point ReadyAt_; /**The load counts as busy until then*/
+    };
+
+    EmulatorConfig Config_; /**Settings, fixed after construction*/
+    BG::Common::Logger::LoggingSystem* Logger_ = nullptr; /**Pointer to the instance of the logging system*/
+    std::unique_ptr<rpc::server> Server_; /**rpclib server instance*/
+
+    std::mutex SimsMutex_; /**Protects Sims_ and NextSimID_*/
+    std::map<int, Simulation> Sims_; /**Loaded simulations by ID*/
+    int NextSimID_ = 0; /**ID given to the next loaded simulation*/
+
+    std::atomic<std::uint64_t> NextSegment_; /**Makes shared memory segment names unique*/
+    std::mutex SegmentsMutex_; /**Protects Segments_*/
+    std::deque<std::pair<std::chrono::steady_clock::time_point, std::string>> Segments_; /**Names of handed out segments, oldest first*/
+    std::atomic<std::uint64_t> EventsReceived_; /**Number of job events pushed to us*/
+
+    std::mutex CallbackMutex_; /**Protects the completion callback state below*/
+    std::condition_variable CallbackCondition_; /**Wakes the callback thread for new loads and on exit*/
+    std::multimap<std::chrono::steady_clock::time_point, int> PendingCompletions_; /**SimIDs by the time their load finishes*/
+    bool StopCallbacks_ = false; /**Tells the callback thread to exit*/
+    std::thread CallbackThread_; /**Calls "NESCompleted" on the configured EVM, only started if one is configured*/
+
+    /**
+     * @brief Body of CallbackThread_, reports each finished load to the configured EVM.
+     */
+    void CallbackThread();
+
+    /**
+     * @brief Sleeps for the configured latency, jitter and transfer time of a reply of the given size.
+     */
+    void Delay(size_t _ReplyBytes);
+
+    /**
+     * @brief Unlinks handed out segments older than SegmentTTL_ms (or all of them), whose reply was lost or never decoded.
+     * Segments a reader already mapped are unlinked by the reader, unlinking them again does nothing.
+     */
+    void ReapSegments(bool _All);
+
+    std::string HandleBatch(const std::string& _Request);
+    nlohmann::json HandleRequest(const std::string& _Name, const nlohmann::json& _Params);
+    nlohmann::json Load(const nlohmann::json& _Params);
+    nlohmann::json GetSomaPositions(const nlohmann::json& _Params);
+    nlohmann::json GetSaveFingerprint(const nlohmann::json& _Params);
+    nlohmann::json Unload(const nlohmann::json& _Params);
+    std::string GetStatus();
+    std::string PushEvents(const std::string& _Request);
+
+    /**
+     * @brief Binds a route whose handler returns the serialized reply, the reply is delayed before it is sent.
+     */
+    void AddRoute(const std::string& _Route, std::function<std::string(const std::string&)> _Handler);
+
+public:
+
+    /**
+     * @brief Construct a new EmulatorServer object, binds all routes and starts serving.
+     * 
+     * @param _Config 
+     * @param _Logger 
+     */
+    EmulatorServer(const EmulatorConfig& _Config, BG::Common::Logger::LoggingSystem* _Logger);
+
+    /**
+     * @brief Destroy the EmulatorServer object, stops the server threads.
+     */
+    ~EmulatorServer();
+
+};
+
+
+}; // Close Namespace NESEmulator
+}; // Close Namespace BG
@@ -0,0 +1,45 @@
+//=================================//
+// This file is part of BrainGenix //
+//=================================//
+
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <chrono>
+#include <thread>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <BG/Common/Logger/Logger.h>
+
+#include <EmulatorConfig.h>
+#include <EmulatorServer.h>
+
+
+/**
+ * @brief Entry point of the NES stand-in server used to benchmark EVM without a real NES.
+ * 
+ * @param NumArguments The number of command-line arguments.
+ * @param ArgumentValues An array containing the command-line arguments.
+ * @return int The exit code of the program.
+ */
+int main(int NumArguments, char** ArgumentValues) {
+
+    BG::NESEmulator::EmulatorConfig Config;
+    if (!BG::NESEmulator::ParseArguments(NumArguments, ArgumentValues, Config)) {
+        return 1;
+    }
+
+    // Setup Logging System
+    BG::Common::Logger::LoggingSystem Logger;
+    Logger.SetKeepVectorLogs(false);
+
+    BG::NESEmulator::EmulatorServer Server(Config, &Logger);
+
+    // Block forever while the server is running
+    while (true) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    return 0;
+}
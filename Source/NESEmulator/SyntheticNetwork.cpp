@@ -0,0 +1,78 @@
+//=================================//
+// This file is part of BrainGenix //
+//=================================//
+
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <stdexcept>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <SyntheticNetwork.h>
+
+
+
+namespace BG {
+namespace NESEmulator {
+
+
+/**
+ * @brief FNV-1a, used instead of std::hash so networks are the same on every platform.
+ */
+static std::uint32_t HashName(const std::string& _Name, std::uint32_t _Seed) {
+    std::uint32_t Hash = 2166136261u ^ _Seed;
+    for (unsigned char Character : _Name) {
+        Hash ^= Character;
+        Hash *= 16777619u;
+    }
+    return Hash;
+}
+
+
+void MakeSyntheticNetwork(const std::string& _SaveName, const EmulatorConfig& _Config, SyntheticNetwork& _Network) {
+
+    // Split "synthetic-<Neurons>-<Tag>", the layout only depends on the part before the tag
+    std::string Layout = _SaveName;
+    int NumNeurons = _Config.DefaultNeurons;
+    const std::string Prefix = "synthetic-";
+    if (_SaveName.compare(0, Prefix.size(), Prefix) == 0) {
+        size_t TagStart = _SaveName.find('-', Prefix.size());
+        Layout = _SaveName.substr(0, TagStart);
+        try {
+            NumNeurons = std::max(0, std::stoi(Layout.substr(Prefix.size())));
+        } catch (std::exception& e) {
+            NumNeurons = _Config.DefaultNeurons;
+        }
+    }
+
+    std::mt19937 LayoutRandom(HashName(Layout, _Config.Seed));
+    std::mt19937 TagRandom(HashName(_SaveName, _Config.Seed));
+    std::uniform_real_distribution<float> Position(0.0f, SYNTHETIC_VOLUME_SIZE_UM);
+    std::uniform_real_distribution<float> Jitter(-SYNTHETIC_TAG_JITTER_UM, SYNTHETIC_TAG_JITTER_UM);
+
+    _Network.SaveName_ = _SaveName;
+    _Network.SomaPositions_.resize(static_cast<size_t>(NumNeurons) * 3);
+    for (float& Coordinate : _Network.SomaPositions_) {
+        Coordinate = Position(LayoutRandom);
+        if (Layout != _SaveName) {
+            Coordinate += Jitter(TagRandom);
+        }
+    }
+}
+
+
+std::string GetSyntheticFingerprint(const std::string& _SaveName, const EmulatorConfig& _Config) {
+    std::uint32_t Hash = HashName(_SaveName + "/" + std::to_string(_Config.DefaultNeurons), _Config.Seed);
+    char Text[9];
+    std::snprintf(Text, sizeof(Text), "%08x", static_cast<unsigned int>(Hash));
+    return Text;
+}
+
+
+}; // Close Namespace NESEmulator
+}; // Close Namespace BG
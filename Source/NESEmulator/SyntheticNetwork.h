@@ -0,0 +1,70 @@
+//=================================================================//
+// This file is part of the BrainGenix-EVM Neuron Emulation System //
+//=================================================================//
+
+/*
+    Description: This file provides the deterministic synthetic networks served by the NES stand-in server.
+    Additional Notes: None
+    Date Created: 2024-05-28
+*/
+
+#pragma once
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <string>
+#include <vector>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <EmulatorConfig.h>
+
+
+
+namespace BG {
+namespace NESEmulator {
+
+
+#define SYNTHETIC_VOLUME_SIZE_UM 1000.0f /**Somas are placed in a cube of this edge length*/
+#define SYNTHETIC_TAG_JITTER_UM 1.0f /**Largest per-axis offset between networks that only differ by tag*/
+
+
+/**
+ * @brief A loaded synthetic network, only soma positions so far.
+ */
+struct SyntheticNetwork {
+    std::string SaveName_; /**Save name it was loaded from*/
+    std::vector<float> SomaPositions_; /**x0,y0,z0,x1,... in um*/
+
+    size_t NumNeurons() const {
+        return SomaPositions_.size() / 3;
+    }
+};
+
+
+/**
+ * @brief Builds the network for a save name, the same name (and seed) always gives the same network.
+ *
+ * Names of the form "synthetic-<Neurons>-<Tag>" give a network of that size. Networks that differ only
+ * by tag share their layout up to a small jitter, so a ground-truth and an emulation save register onto
+ * each other, e.g. "synthetic-5000-kgt" and "synthetic-5000-emu". Any other name gives a network of
+ * the default size.
+ * 
+ * @param _SaveName 
+ * @param _Config 
+ * @param _Network 
+ */
+void MakeSyntheticNetwork(const std::string& _SaveName, const EmulatorConfig& _Config, SyntheticNetwork& _Network);
+
+/**
+ * @brief Returns the fingerprint of a save, it changes whenever a setting changes the network built for the name.
+ * 
+ * @param _SaveName 
+ * @param _Config 
+ * @return std::string Hex text.
+ */
+std::string GetSyntheticFingerprint(const std::string& _SaveName, const EmulatorConfig& _Config);
+
+
+}; // Close Namespace NESEmulator
+}; // Close Namespace BG
@@ -0,0 +1,95 @@
+//=================================//
+// This file is part of BrainGenix //
+//=================================//
+
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <chrono>
+#include <future>
+#include <thread>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+#include <gtest/gtest.h>
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <RPC/AdmissionControl.h>
+
+
+namespace BG {
+namespace Tests {
+
+
+static EVM::API::RouteLimits MakeLimits(int _MaxConcurrent, int _MaxQueued) {
+    EVM::API::RouteLimits Limits;
+    Limits.MaxConcurrent = _MaxConcurrent;
+    Limits.MaxQueued = _MaxQueued;
+    return Limits;
+}
+
+
+TEST(AdmissionControl, UnlimitedRouteAdmitsEveryCall) {
+    EVM::API::AdmissionController Controller(MakeLimits(0, 0), 100);
+    for (int i = 0; i < 100; i++) {
+        EXPECT_TRUE(Controller.Acquire("EVM"));
+    }
+}
+
+
+TEST(AdmissionControl, SaturatedRouteRejectsWithoutQueue) {
+    EVM::API::AdmissionController Controller(MakeLimits(0, 0), 100);
+    Controller.SetRouteLimits("EVM", MakeLimits(2, 0));
+
+    EXPECT_TRUE(Controller.Acquire("EVM"));
+    EXPECT_TRUE(Controller.Acquire("EVM"));
+    EXPECT_FALSE(Controller.Acquire("EVM"));
+
+    // Other routes keep their own limits
+    EXPECT_TRUE(Controller.Acquire("Echo"));
+
+    Controller.Release("EVM");
+    EXPECT_TRUE(Controller.Acquire("EVM"));
+}
+
+
+TEST(AdmissionControl, QueuedCallGetsReleasedSlot) {
+    EVM::API::AdmissionController Controller(MakeLimits(1, 1), 5000);
+    ASSERT_TRUE(Controller.Acquire("EVM"));
+
+    std::future<bool> Queued = std::async(std::launch::async, [&Controller]() { return Controller.Acquire("EVM"); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    // The queue holds one call, the next one is turned away at once
+    EXPECT_FALSE(Controller.Acquire("EVM"));
+
+    Controller.Release("EVM");
+    ASSERT_EQ(Queued.wait_for(std::chrono::seconds(2)), std::future_status::ready);
+    EXPECT_TRUE(Queued.get());
+}
+
+
+TEST(AdmissionControl, QueuedCallTimesOut) {
+    EVM::API::AdmissionController Controller(MakeLimits(1, 1), 50);
+    ASSERT_TRUE(Controller.Acquire("EVM"));
+
+    std::chrono::steady_clock::time_point Start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(Controller.Acquire("EVM"));
+    EXPECT_GE(std::chrono::steady_clock::now() - Start, std::chrono::milliseconds(50));
+}
+
+
+TEST(AdmissionControl, TicketReleasesItsSlot) {
+    EVM::API::AdmissionController Controller(MakeLimits(1, 0), 100);
+    {
+        EVM::API::AdmissionTicket Ticket(Controller, "EVM");
+        EXPECT_TRUE(Ticket.IsAdmitted());
+
+        EVM::API::AdmissionTicket Busy(Controller, "EVM");
+        EXPECT_FALSE(Busy.IsAdmitted());
+    }
+    EVM::API::AdmissionTicket Ticket(Controller, "EVM");
+    EXPECT_TRUE(Ticket.IsAdmitted());
+}
+
+
+}; // Close Namespace Tests
+}; // Close Namespace BG
@@ -0,0 +1,142 @@
+//=================================//
+// This file is part of BrainGenix //
+//=================================//
+
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <unistd.h>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+#include <gtest/gtest.h>
+
+#include <nlohmann/json.hpp>
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <Util/BulkArray.h>
+#include <Util/SharedMemory.h>
+
+#include <TestNES.h>
+
+
+namespace BG {
+namespace Tests {
+
+
+/**
+ * Creates a segment holding the floats 0, 1, ... _Count - 1 and returns its descriptor, as NES would.
+ * The segment is left linked, like one handed over by NES.
+ */
+static nlohmann::json MakeSegment(size_t _Count) {
+    static std::atomic<int> NextSegment{0};
+    std::string Name = "/bgevm-test-" + std::to_string(getpid()) + "-" + std::to_string(NextSegment++);
+    {
+        EVM::Util::SharedMemorySegment Segment;
+        EXPECT_TRUE(Segment.Create(Name, _Count * sizeof(float)));
+        for (size_t i = 0; i < _Count; i++) {
+            float Value = float(i);
+            std::memcpy(static_cast<char*>(Segment.Data()) + i * sizeof(float), &Value, sizeof(float));
+        }
+    }
+    nlohmann::json Descriptor;
+    Descriptor["SHMName"] = Name;
+    Descriptor["Offset"] = 0;
+    Descriptor["Count"] = _Count;
+    Descriptor["DType"] = "float32";
+    return Descriptor;
+}
+
+
+TEST(BulkArray, DescriptorIsMappedWithoutCopy) {
+    nlohmann::json Descriptor = MakeSegment(8);
+    Descriptor["Offset"] = 2 * sizeof(float);
+    Descriptor["Count"] = 6;
+
+    EVM::Util::BulkArray<float> Values;
+    ASSERT_TRUE(EVM::Util::DecodeBulkArray(Descriptor, Values));
+    EXPECT_TRUE(Values.IsZeroCopy());
+    ASSERT_EQ(Values.size(), 6);
+    EXPECT_FLOAT_EQ(Values[0], 2.0f);
+    EXPECT_FLOAT_EQ(Values[5], 7.0f);
+    EXPECT_FALSE(SharedMemoryExists(Descriptor["SHMName"]));
+}
+
+
+TEST(BulkArray, DescriptorPastTheSegmentIsRejected) {
+    EVM::Util::BulkArray<float> Values;
+
+    nlohmann::json TooMany = MakeSegment(4);
+    TooMany["Count"] = 5;
+    EXPECT_FALSE(EVM::Util::DecodeBulkArray(TooMany, Values));
+
+    nlohmann::json OffsetTooFar = MakeSegment(4);
+    OffsetTooFar["Offset"] = 8 * sizeof(float);
+    OffsetTooFar["Count"] = 0;
+    EXPECT_FALSE(EVM::Util::DecodeBulkArray(OffsetTooFar, Values));
+
+    nlohmann::json OffsetPlusCount = MakeSegment(4);
+    OffsetPlusCount["Offset"] = 2 * sizeof(float);
+    OffsetPlusCount["Count"] = 3;
+    EXPECT_FALSE(EVM::Util::DecodeBulkArray(OffsetPlusCount, Values));
+
+    nlohmann::json Huge = MakeSegment(4);
+    Huge["Count"] = std::uint64_t(-1) / 2;
+    EXPECT_FALSE(EVM::Util::DecodeBulkArray(Huge, Values));
+
+    // Whatever was wrong, the handed over segment is gone
+    for (const nlohmann::json* Descriptor : {&TooMany, &OffsetTooFar, &OffsetPlusCount, &Huge}) {
+        EXPECT_FALSE(SharedMemoryExists((*Descriptor)["SHMName"]));
+    }
+    EXPECT_TRUE(Values.empty());
+}
+
+
+TEST(BulkArray, MalformedDescriptorIsRejected) {
+    EVM::Util::BulkArray<float> Values;
+    EVM::Util::BulkArray<int> Ints;
+
+    nlohmann::json WrongDType = MakeSegment(4);
+    EXPECT_FALSE(EVM::Util::DecodeBulkArray(WrongDType, Ints));
+
+    nlohmann::json UnknownDType = MakeSegment(4);
+    UnknownDType["DType"] = "float16";
+    EXPECT_FALSE(EVM::Util::DecodeBulkArray(UnknownDType, Values));
+
+    nlohmann::json Misaligned = MakeSegment(4);
+    Misaligned["Offset"] = 2;
+    Misaligned["Count"] = 1;
+    EXPECT_FALSE(EVM::Util::DecodeBulkArray(Misaligned, Values));
+
+    nlohmann::json NegativeCount = MakeSegment(4);
+    NegativeCount["Count"] = -1;
+    EXPECT_FALSE(EVM::Util::DecodeBulkArray(NegativeCount, Values));
+
+    nlohmann::json NegativeOffset = MakeSegment(4);
+    NegativeOffset["Offset"] = -4;
+    EXPECT_FALSE(EVM::Util::DecodeBulkArray(NegativeOffset, Values));
+
+    nlohmann::json StringCount = MakeSegment(4);
+    StringCount["Count"] = "4";
+    EXPECT_FALSE(EVM::Util::DecodeBulkArray(StringCount, Values));
+
+    nlohmann::json MissingCount = MakeSegment(4);
+    MissingCount.erase("Count");
+    EXPECT_FALSE(EVM::Util::DecodeBulkArray(MissingCount, Values));
+
+    for (const nlohmann::json* Descriptor : {&WrongDType, &UnknownDType, &Misaligned, &NegativeCount, &NegativeOffset, &StringCount, &MissingCount}) {
+        EXPECT_FALSE(SharedMemoryExists((*Descriptor)["SHMName"]));
+    }
+
+    // Missing segments and invalid names fail cleanly
+    EXPECT_FALSE(EVM::Util::DecodeBulkArray(nlohmann::json::parse("{\"SHMName\": \"/bgevm-test-missing\", \"Count\": 1, \"DType\": \"float32\"}"), Values));
+    EXPECT_FALSE(EVM::Util::DecodeBulkArray(nlohmann::json::parse("{\"SHMName\": \"/dev/shm/x\", \"Count\": 1, \"DType\": \"float32\"}"), Values));
+    EXPECT_FALSE(EVM::Util::DecodeBulkArray(nlohmann::json::parse("{\"SHMName\": 7, \"Count\": 1, \"DType\": \"float32\"}"), Values));
+    EXPECT_TRUE(Values.empty());
+    EXPECT_TRUE(Ints.empty());
+}
+
+
+}; // Close Namespace Tests
+}; // Close Namespace BG
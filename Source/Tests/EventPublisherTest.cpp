@@ -0,0 +1,112 @@
+//=================================//
+// This file is part of BrainGenix //
+//=================================//
+
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+#include <gtest/gtest.h>
+
+#include <nlohmann/json.hpp>
+#include <rpc/server.h>
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <RPC/EventPublisher.h>
+#include <RPC/SafeClient.h>
+#include <Util/LazyLogger.h>
+
+#include <Version.h>
+
+#include <TestNES.h>
+
+
+namespace BG {
+namespace Tests {
+
+
+/**
+ * Stand-in API service that records the job events pushed to it.
+ */
+class EventSink {
+private:
+    rpc::server Server_;
+    std::mutex Mutex_;
+    std::vector<nlohmann::json> Events_;
+public:
+    EventSink(int _Port) : Server_(TEST_NES_HOST, _Port) {
+        Server_.bind("GetAPIVersion", []() { return std::string(VERSION); });
+        Server_.bind(EVENT_PUSH_ROUTE, [this](std::string _Request) {
+            nlohmann::json Request = nlohmann::json::parse(_Request);
+            std::lock_guard<std::mutex> Lock(Mutex_);
+            for (const nlohmann::json& Event : Request["Events"]) {
+                Events_.push_back(Event);
+            }
+            return std::string("{\"StatusCode\":0}");
+        });
+        Server_.async_run(2);
+    }
+
+    std::vector<nlohmann::json> GetEvents() {
+        std::lock_guard<std::mutex> Lock(Mutex_);
+        return Events_;
+    }
+};
+
+
+// Once MaxPending jobs wait, a completion pushes out a progress event and further progress is dropped
+TEST(EventPublisher, PendingBoundKeepsCompletions) {
+    const int Port = TEST_NES_BASE_PORT + 10;
+    EventSink Sink(Port);
+
+    SafeClient Client(GetTestLogger(), 1);
+    Client.SetTimeout(2000);
+    Client.SetHostPort(TEST_NES_HOST, Port);
+    ASSERT_TRUE(WaitFor([&]() { return Client.IsHealthy(); }));
+
+    EVM::Util::LazyLogger Log(GetTestLogger());
+    {
+        // Nothing is flushed before the destructor's last attempt
+        EVM::API::EventPublisher Publisher(&Client, &Log, 60000, 100, 3, 2);
+        Publisher.SetEnabled(true);
+        Publisher.Publish("Job-1", EVM::API::JOB_EVENT_PROGRESS, nlohmann::json::object());
+        Publisher.Publish("Job-2", EVM::API::JOB_EVENT_PROGRESS, nlohmann::json::object());
+        Publisher.Publish("Job-3", EVM::API::JOB_EVENT_COMPLETED, nlohmann::json::object());
+        Publisher.Publish("Job-4", EVM::API::JOB_EVENT_PROGRESS, nlohmann::json::object());
+        EXPECT_EQ(Publisher.GetDroppedCount(), 2);
+    }
+
+    std::vector<nlohmann::json> Events = Sink.GetEvents();
+    ASSERT_EQ(Events.size(), 2);
+    bool HasCompletion = false;
+    for (const nlohmann::json& Event : Events) {
+        HasCompletion |= Event["JobID"] == "Job-3" && Event["Event"] == "Completed";
+    }
+    EXPECT_TRUE(HasCompletion);
+}
+
+
+// Without a reachable API service events are dropped after MaxRetries failed sends
+TEST(EventPublisher, FailedEventsAreDroppedAfterRetries) {
+    const int Port = TEST_NES_BASE_PORT + 11; // Nothing listens here
+
+    SafeClient Client(GetTestLogger(), 1);
+    Client.SetTimeout(200);
+    Client.SetHostPort(TEST_NES_HOST, Port);
+
+    EVM::Util::LazyLogger Log(GetTestLogger());
+    EVM::API::EventPublisher Publisher(&Client, &Log, 10, 100, 3, 16);
+    Publisher.SetEnabled(true);
+    Publisher.Publish("Job-1", EVM::API::JOB_EVENT_COMPLETED, nlohmann::json::object());
+    Publisher.Publish("Job-2", EVM::API::JOB_EVENT_PROGRESS, nlohmann::json::object());
+
+    EXPECT_TRUE(WaitFor([&]() { return Publisher.GetDroppedCount() == 2; }));
+}
+
+
+}; // Close Namespace Tests
+}; // Close Namespace BG
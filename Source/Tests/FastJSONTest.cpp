@@ -0,0 +1,115 @@
+//=================================//
+// This file is part of BrainGenix //
+//=================================//
+
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+#include <gtest/gtest.h>
+
+#include <nlohmann/json.hpp>
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <Util/FastJSON.h>
+#include <Util/JSONHelpers.h>
+
+
+namespace BG {
+namespace Tests {
+
+
+/**
+ * Runs both the raw text path (simdjson if built with it) and the DOM path on the same input,
+ * checks that they agree and returns the result of the raw text path.
+ */
+template <typename T>
+static bool ExtractBoth(const std::string& _JSON, const std::string& _Pointer, std::vector<T>& _Out) {
+    bool Extracted = EVM::Util::ExtractNumberArray(_JSON, _Pointer, _Out);
+
+    std::vector<T> FromDOM;
+    bool Decoded = false;
+    nlohmann::json Document = nlohmann::json::parse(_JSON, nullptr, false);
+    try {
+        nlohmann::json::json_pointer Pointer(_Pointer);
+        Decoded = !Document.is_discarded() && Document.contains(Pointer) && EVM::Util::GetNumberArray(Document.at(Pointer), FromDOM);
+    } catch (nlohmann::json::exception&) {
+        Decoded = false;
+    }
+
+    EXPECT_EQ(Extracted, Decoded) << _JSON << " at '" << _Pointer << "'";
+    if (Extracted && Decoded) {
+        EXPECT_EQ(_Out, FromDOM) << _JSON << " at '" << _Pointer << "'";
+    }
+    return Extracted;
+}
+
+
+TEST(FastJSON, BuildFlagSelectsTheParser) {
+#ifdef BG_EVM_WITH_SIMDJSON
+    EXPECT_TRUE(EVM::Util::HasFastJSON());
+#else
+    EXPECT_FALSE(EVM::Util::HasFastJSON());
+#endif
+}
+
+
+TEST(FastJSON, NestedArraysAreFlattenedInDocumentOrder) {
+    std::vector<float> Positions;
+    ASSERT_TRUE(ExtractBoth<float>("[{\"ReqID\": 0, \"SomaPositions\": [[1, 2, 3], [4.5, 5, 6]]}]", "/0/SomaPositions", Positions));
+    EXPECT_EQ(Positions, std::vector<float>({1.0f, 2.0f, 3.0f, 4.5f, 5.0f, 6.0f}));
+
+    std::vector<int> Deep;
+    ASSERT_TRUE(ExtractBoth<int>("{\"A\": [1, [2, [3, []], 4], [[5]]]}", "/A", Deep));
+    EXPECT_EQ(Deep, std::vector<int>({1, 2, 3, 4, 5}));
+
+    std::vector<double> Empty;
+    ASSERT_TRUE(ExtractBoth<double>("{\"A\": []}", "/A", Empty));
+    EXPECT_TRUE(Empty.empty());
+}
+
+
+TEST(FastJSON, NonNumericElementsAreRejected) {
+    std::vector<float> Values;
+    EXPECT_FALSE(ExtractBoth<float>("{\"A\": [1, \"2\", 3]}", "/A", Values));
+    EXPECT_FALSE(ExtractBoth<float>("{\"A\": [1, null]}", "/A", Values));
+    EXPECT_FALSE(ExtractBoth<float>("{\"A\": [true]}", "/A", Values));
+    EXPECT_FALSE(ExtractBoth<float>("{\"A\": [[1, 2], {\"x\": 3}]}", "/A", Values));
+    EXPECT_FALSE(ExtractBoth<float>("{\"A\": {\"x\": 1}}", "/A", Values));
+}
+
+
+TEST(FastJSON, MissingOrInvalidPointerIsRejected) {
+    std::vector<int> Values;
+    EXPECT_FALSE(ExtractBoth<int>("[{\"A\": [1]}]", "/0/B", Values));
+    EXPECT_FALSE(ExtractBoth<int>("[{\"A\": [1]}]", "/1/A", Values));
+    EXPECT_FALSE(ExtractBoth<int>("[{\"A\": [1]}]", "/x/A", Values));
+    EXPECT_FALSE(ExtractBoth<int>("[{\"A\": [1]}]", "0/A", Values));
+    EXPECT_FALSE(ExtractBoth<int>("[{\"A\": [1, 2", "/0/A", Values));
+    EXPECT_TRUE(Values.empty());
+}
+
+
+// Integer buffers take integers only, float buffers take both
+TEST(FastJSON, IntegerAndFloatTyping) {
+    std::vector<int> Ints;
+    ASSERT_TRUE(ExtractBoth<int>("{\"A\": [-3, 0, 7]}", "/A", Ints));
+    EXPECT_EQ(Ints, std::vector<int>({-3, 0, 7}));
+    EXPECT_FALSE(ExtractBoth<int>("{\"A\": [1, 2.5]}", "/A", Ints));
+    EXPECT_FALSE(ExtractBoth<int>("{\"A\": [1.0]}", "/A", Ints));
+
+    std::vector<std::int64_t> Wide;
+    ASSERT_TRUE(ExtractBoth<std::int64_t>("{\"A\": [5000000000, -1]}", "/A", Wide));
+    EXPECT_EQ(Wide, std::vector<std::int64_t>({5000000000LL, -1}));
+
+    std::vector<double> Doubles;
+    ASSERT_TRUE(ExtractBoth<double>("{\"A\": [1, 2.5, -0.125, 1e3]}", "/A", Doubles));
+    EXPECT_EQ(Doubles, std::vector<double>({1.0, 2.5, -0.125, 1000.0}));
+}
+
+
+}; // Close Namespace Tests
+}; // Close Namespace BG
@@ -0,0 +1,176 @@
+//=================================//
+// This file is part of BrainGenix //
+//=================================//
+
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <vector>
+#include <unistd.h>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+#include <gtest/gtest.h>
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <NESInteraction/NESDataCache.h>
+
+#include <TestNES.h>
+
+
+namespace BG {
+namespace Tests {
+
+
+/**
+ * A cache in a fresh directory of its own, removed again afterwards.
+ */
+class NESDataCacheTest : public ::testing::Test {
+protected:
+    std::string Directory_;
+    std::unique_ptr<NESDataCache> Cache_;
+
+    void SetUp() override {
+        Directory_ = (std::filesystem::temp_directory_path() / ("bgevm-cache-test-" + std::to_string(getpid()) + "-" + ::testing::UnitTest::GetInstance()->current_test_info()->name())).string();
+        std::error_code Error;
+        std::filesystem::remove_all(Directory_, Error);
+        Cache_ = std::make_unique<NESDataCache>(GetTestLogger(), Directory_);
+    }
+
+    void TearDown() override {
+        Cache_.reset();
+        std::error_code Error;
+        std::filesystem::remove_all(Directory_, Error);
+    }
+
+    /**
+     * Returns the snapshot files in the directory.
+     */
+    std::vector<std::string> GetSnapshots() {
+        std::vector<std::string> Paths;
+        for (const std::filesystem::directory_entry& Entry : std::filesystem::directory_iterator(Directory_)) {
+            Paths.push_back(Entry.path().string());
+        }
+        return Paths;
+    }
+
+    /**
+     * Dataset with soma positions, neuron types and a recording.
+     */
+    static SimDataset MakeDataset(float _First) {
+        SimDataset Dataset;
+        Dataset.SomaPositions_.Assign({_First, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f});
+        Dataset.NeuronTypes_.Assign({1, 2});
+        Dataset.RecordingTimes_ms_.Assign({0.0f, 0.5f});
+        Dataset.Recording_.Assign({-70.0f, -65.0f, -60.0f, -55.0f});
+        Dataset.Fields_ = NES_DATA_SOMA_POSITIONS | NES_DATA_NEURON_TYPES | NES_DATA_RECORDINGS;
+        return Dataset;
+    }
+};
+
+
+TEST_F(NESDataCacheTest, StoredSnapshotIsLoadedFromTheMapping) {
+    ASSERT_TRUE(Cache_->Store("synthetic-2", "fp-1", MakeDataset(1.0f)));
+
+    SimDataset Loaded;
+    ASSERT_TRUE(Cache_->Load("synthetic-2", "fp-1", NES_DATA_SOMA_POSITIONS | NES_DATA_RECORDINGS, Loaded));
+    EXPECT_EQ(Loaded.Fields_, NES_DATA_SOMA_POSITIONS | NES_DATA_NEURON_TYPES | NES_DATA_RECORDINGS);
+    EXPECT_TRUE(Loaded.SomaPositions_.IsZeroCopy());
+    EXPECT_EQ(std::vector<float>(Loaded.SomaPositions_.begin(), Loaded.SomaPositions_.end()), std::vector<float>({1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f}));
+    EXPECT_EQ(std::vector<int>(Loaded.NeuronTypes_.begin(), Loaded.NeuronTypes_.end()), std::vector<int>({1, 2}));
+    EXPECT_EQ(std::vector<float>(Loaded.Recording_.begin(), Loaded.Recording_.end()), std::vector<float>({-70.0f, -65.0f, -60.0f, -55.0f}));
+    EXPECT_EQ(Loaded.RecordingTimes_ms_.size(), 2);
+    EXPECT_TRUE(Loaded.ConnectionPairs_.empty());
+}
+
+
+TEST_F(NESDataCacheTest, OtherFingerprintIsAMiss) {
+    ASSERT_TRUE(Cache_->Store("synthetic-2", "fp-1", MakeDataset(1.0f)));
+
+    SimDataset Loaded;
+    EXPECT_FALSE(Cache_->Load("synthetic-2", "fp-2", NES_DATA_SOMA_POSITIONS, Loaded));
+    EXPECT_FALSE(Cache_->Load("synthetic-3", "fp-1", NES_DATA_SOMA_POSITIONS, Loaded));
+    EXPECT_EQ(Loaded.Fields_, 0);
+}
+
+
+TEST_F(NESDataCacheTest, FieldsNotInTheSnapshotAreAMiss) {
+    ASSERT_TRUE(Cache_->Store("synthetic-2", "fp-1", MakeDataset(1.0f)));
+
+    SimDataset Loaded;
+    EXPECT_FALSE(Cache_->Load("synthetic-2", "fp-1", NES_DATA_SOMA_POSITIONS | NES_DATA_CONNECTIVITY, Loaded));
+    EXPECT_FALSE(Cache_->Load("synthetic-2", "fp-1", NES_DATA_COMPARTMENTS, Loaded));
+    EXPECT_EQ(Loaded.Fields_, 0);
+}
+
+
+TEST_F(NESDataCacheTest, TruncatedOrCorruptSnapshotIsRejected) {
+    ASSERT_TRUE(Cache_->Store("synthetic-2", "fp-1", MakeDataset(1.0f)));
+    std::vector<std::string> Snapshots = GetSnapshots();
+    ASSERT_EQ(Snapshots.size(), 1);
+    const std::string& Path = Snapshots[0];
+    std::uintmax_t Size = std::filesystem::file_size(Path);
+    SimDataset Loaded;
+
+    // The last array is cut short
+    std::filesystem::resize_file(Path, Size - 4);
+    EXPECT_FALSE(Cache_->Load("synthetic-2", "fp-1", NES_DATA_SOMA_POSITIONS, Loaded));
+
+    // Only part of the header is left
+    std::filesystem::resize_file(Path, 10);
+    EXPECT_FALSE(Cache_->Load("synthetic-2", "fp-1", NES_DATA_SOMA_POSITIONS, Loaded));
+
+    // Empty file
+    std::filesystem::resize_file(Path, 0);
+    EXPECT_FALSE(Cache_->Load("synthetic-2", "fp-1", NES_DATA_SOMA_POSITIONS, Loaded));
+
+    // Wrong magic, and a table that claims more entries than the file holds
+    ASSERT_TRUE(Cache_->Store("synthetic-2", "fp-1", MakeDataset(1.0f)));
+    {
+        std::fstream File(Path, std::ios::binary | std::ios::in | std::ios::out);
+        File.write("NOTSNAP!", 8);
+    }
+    EXPECT_FALSE(Cache_->Load("synthetic-2", "fp-1", NES_DATA_SOMA_POSITIONS, Loaded));
+
+    ASSERT_TRUE(Cache_->Store("synthetic-2", "fp-1", MakeDataset(1.0f)));
+    {
+        std::fstream File(Path, std::ios::binary | std::ios::in | std::ios::out);
+        File.seekp(12); // NumArrays_
+        const char Huge[4] = {'\xff', '\xff', '\xff', '\x7f'};
+        File.write(Huge, 4);
+    }
+    EXPECT_FALSE(Cache_->Load("synthetic-2", "fp-1", NES_DATA_SOMA_POSITIONS, Loaded));
+    EXPECT_EQ(Loaded.Fields_, 0);
+
+    // Storing again repairs it
+    ASSERT_TRUE(Cache_->Store("synthetic-2", "fp-1", MakeDataset(1.0f)));
+    EXPECT_TRUE(Cache_->Load("synthetic-2", "fp-1", NES_DATA_SOMA_POSITIONS, Loaded));
+}
+
+
+TEST_F(NESDataCacheTest, NewFingerprintReplacesOlderSnapshots) {
+    ASSERT_TRUE(Cache_->Store("synthetic:2", "fp-1", MakeDataset(1.0f)));
+    ASSERT_TRUE(Cache_->Store("synthetic;2", "fp-1", MakeDataset(9.0f))); // Same readable file name part, another save
+
+    // A reader of the old snapshot keeps its mapping
+    SimDataset Old;
+    ASSERT_TRUE(Cache_->Load("synthetic:2", "fp-1", NES_DATA_SOMA_POSITIONS, Old));
+
+    ASSERT_TRUE(Cache_->Store("synthetic:2", "fp-2", MakeDataset(7.0f)));
+    EXPECT_EQ(GetSnapshots().size(), 2);
+
+    SimDataset Loaded;
+    EXPECT_FALSE(Cache_->Load("synthetic:2", "fp-1", NES_DATA_SOMA_POSITIONS, Loaded));
+    ASSERT_TRUE(Cache_->Load("synthetic:2", "fp-2", NES_DATA_SOMA_POSITIONS, Loaded));
+    EXPECT_FLOAT_EQ(Loaded.SomaPositions_[0], 7.0f);
+    ASSERT_TRUE(Cache_->Load("synthetic;2", "fp-1", NES_DATA_SOMA_POSITIONS, Loaded));
+    EXPECT_FLOAT_EQ(Loaded.SomaPositions_[0], 9.0f);
+    EXPECT_FLOAT_EQ(Old.SomaPositions_[0], 1.0f);
+}
+
+
+}; // Close Namespace Tests
+}; // Close Namespace BG
@@ -0,0 +1,189 @@
+//=================================//
+// This file is part of BrainGenix //
+//=================================//
+
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+#include <gtest/gtest.h>
+
+#include <nlohmann/json.hpp>
+#include <rpc/server.h>
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <NESInteraction/NESDataFetch.h>
+#include <RPC/SafeClient.h>
+
+#include <Version.h>
+
+#include <TestNES.h>
+
+
+namespace BG {
+namespace Tests {
+
+
+/**
+ * NES stand-in that answers every batch with the same canned response.
+ */
+class CannedNES {
+private:
+    rpc::server Server_;
+public:
+    CannedNES(int _Port, std::string _Response) : Server_(TEST_NES_HOST, _Port) {
+        Server_.bind("GetAPIVersion", []() { return std::string(VERSION); });
+        Server_.bind(NES_BATCH_ROUTE, [_Response](std::string _Request) { return _Response; });
+        Server_.async_run(2);
+    }
+};
+
+
+// Elements come out of order, nested arrays are flattened and the small fields sit between the bulk ones
+TEST(NESDataFetch, MixedBatchIsDecodedFromTheRawResponse) {
+    const int Port = TEST_NES_BASE_PORT + 30;
+    CannedNES NES(Port, "["
+        "{\"ReqID\": 2, \"CompartmentPositions\": [[0.5, 1.5, 2.5]], \"StatusCode\": 0, \"CompartmentNeurons\": [1]},"
+        "{\"SomaPositions\": [[1, 2, 3], [4.5, 5, 6]], \"ReqID\": 0, \"StatusCode\": 0},"
+        "{\"ReqID\": 1, \"StatusCode\": 0, \"NeuronTypes\": [3, 7]}"
+    "]");
+
+    SafeClient Client(GetTestLogger(), 1);
+    Client.SetTimeout(2000);
+    Client.SetHostPort(TEST_NES_HOST, Port);
+    ASSERT_TRUE(WaitFor([&]() { return Client.IsHealthy(); }));
+
+    NESSim Sim;
+    Sim.Client_ = &Client;
+    Sim.SimID_ = 0;
+    SimDataset Dataset;
+    unsigned Fields = NES_DATA_SOMA_POSITIONS | NES_DATA_NEURON_TYPES | NES_DATA_COMPARTMENTS;
+    ASSERT_TRUE(FetchSimDataset(GetTestLogger(), Sim, Fields, Dataset));
+    EXPECT_EQ(Dataset.Fields_, Fields);
+
+    ASSERT_EQ(Dataset.SomaPositions_.size(), 6);
+    EXPECT_FLOAT_EQ(Dataset.SomaPositions_[3], 4.5f);
+    EXPECT_FLOAT_EQ(Dataset.SomaPositions_[5], 6.0f);
+    ASSERT_EQ(Dataset.NeuronTypes_.size(), 2);
+    EXPECT_EQ(Dataset.NeuronTypes_[1], 7);
+    ASSERT_EQ(Dataset.CompartmentPositions_.size(), 3);
+    EXPECT_FLOAT_EQ(Dataset.CompartmentPositions_[2], 2.5f);
+    ASSERT_EQ(Dataset.CompartmentNeurons_.size(), 1);
+    EXPECT_EQ(Dataset.CompartmentNeurons_[0], 1);
+    EXPECT_FALSE(Dataset.SomaPositions_.IsZeroCopy());
+}
+
+
+TEST(NESDataFetch, NonNumericBulkArrayFailsTheFetch) {
+    const int Port = TEST_NES_BASE_PORT + 31;
+    CannedNES NES(Port, "["
+        "{\"ReqID\": 0, \"StatusCode\": 0, \"SomaPositions\": [1, 2, 3]},"
+        "{\"ReqID\": 1, \"StatusCode\": 0, \"NeuronTypes\": [1, \"two\"]}"
+    "]");
+
+    SafeClient Client(GetTestLogger(), 1);
+    Client.SetTimeout(2000);
+    Client.SetHostPort(TEST_NES_HOST, Port);
+    ASSERT_TRUE(WaitFor([&]() { return Client.IsHealthy(); }));
+
+    NESSim Sim;
+    Sim.Client_ = &Client;
+    Sim.SimID_ = 0;
+    SimDataset Dataset;
+    EXPECT_FALSE(FetchSimDataset(GetTestLogger(), Sim, NES_DATA_SOMA_POSITIONS | NES_DATA_NEURON_TYPES, Dataset));
+    EXPECT_EQ(Dataset.Fields_, 0);
+}
+
+// The same soma positions come inline and as a shared memory view, the segment is gone once mapped
+TEST(NESDataFetch, SharedMemoryTransportMapsTheSegment) {
+    const int Port = TEST_NES_BASE_PORT + 32;
+    std::unique_ptr<NESEmulator::EmulatorServer> NES = StartTestNES(Port);
+
+    SafeClient Client(GetTestLogger(), 1);
+    Client.SetTimeout(2000);
+    Client.SetHostPort(TEST_NES_HOST, Port);
+    ASSERT_TRUE(WaitFor([&]() { return Client.IsHealthy(); }));
+
+    std::string Response;
+    ASSERT_TRUE(Client.MakeJSONQuery("Simulation/Load", "[{\"ReqID\": 0, \"Simulation/Load\": {\"SavedSimName\": \"synthetic-40\"}}]", &Response));
+    NESSim Sim;
+    Sim.Client_ = &Client;
+    Sim.SimID_ = nlohmann::json::parse(Response)[0]["SimulationID"].get<int>();
+
+    SimDataset Inline;
+    ASSERT_TRUE(WaitFor([&]() { return FetchSimDataset(GetTestLogger(), Sim, NES_DATA_SOMA_POSITIONS, Inline); }));
+    EXPECT_FALSE(Inline.SomaPositions_.IsZeroCopy());
+
+    Client.SetSharedMemoryTransport(true);
+    ASSERT_TRUE(Client.UsesSharedMemoryTransport());
+    SimDataset Mapped;
+    ASSERT_TRUE(FetchSimDataset(GetTestLogger(), Sim, NES_DATA_SOMA_POSITIONS, Mapped));
+    EXPECT_TRUE(Mapped.SomaPositions_.IsZeroCopy());
+    ASSERT_EQ(Mapped.SomaPositions_.size(), 40 * 3);
+    for (size_t i = 0; i < Mapped.SomaPositions_.size(); i++) {
+        ASSERT_EQ(Mapped.SomaPositions_[i], Inline.SomaPositions_[i]) << "at " << i;
+    }
+    EXPECT_TRUE(GetTestNESSegments().empty());
+}
+
+
+// A segment whose reply is never decoded is removed by the server after its TTL, the rest on shutdown
+TEST(NESDataFetch, UnclaimedSegmentsAreRemoved) {
+    const int Port = TEST_NES_BASE_PORT + 33;
+    std::unique_ptr<NESEmulator::EmulatorServer> NES = StartTestNES(Port, 0, 0.0, 50);
+
+    SafeClient Client(GetTestLogger(), 1);
+    Client.SetTimeout(2000);
+    Client.SetHostPort(TEST_NES_HOST, Port);
+    ASSERT_TRUE(WaitFor([&]() { return Client.IsHealthy(); }));
+
+    std::string Response;
+    ASSERT_TRUE(Client.MakeJSONQuery("Simulation/Load", "[{\"ReqID\": 0, \"Simulation/Load\": {\"SavedSimName\": \"synthetic-10\"}}]", &Response));
+    std::string Request = "[{\"ReqID\": 0, \"Simulation/GetSomaPositions\": {\"SimID\": " + std::to_string(nlohmann::json::parse(Response)[0]["SimulationID"].get<int>()) + ", \"BulkTransport\": \"SHM\"}}]";
+
+    auto RequestSegment = [&]() {
+        std::string Reply;
+        EXPECT_TRUE(WaitFor([&]() {
+            return Client.MakeJSONQuery("Simulation/GetSomaPositions", Request, &Reply) && nlohmann::json::parse(Reply)[0].value("StatusCode", -1) == 0;
+        }));
+        return nlohmann::json::parse(Reply)[0]["SomaPositions"]["SHMName"].get<std::string>();
+    };
+
+    std::string First = RequestSegment();
+    EXPECT_TRUE(SharedMemoryExists(First));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    std::string Second = RequestSegment();
+    EXPECT_FALSE(SharedMemoryExists(First));
+    EXPECT_TRUE(SharedMemoryExists(Second));
+
+    NES.reset();
+    EXPECT_FALSE(SharedMemoryExists(Second));
+    EXPECT_TRUE(GetTestNESSegments().empty());
+}
+
+TEST(NESDataFetch, FingerprintsOfBothSavesInOneRoundTrip) {
+    const int Port = TEST_NES_BASE_PORT + 34;
+    std::unique_ptr<NESEmulator::EmulatorServer> NES = StartTestNES(Port, 200);
+
+    SafeClient Client(GetTestLogger(), 1);
+    Client.SetTimeout(3000);
+    Client.SetHostPort(TEST_NES_HOST, Port);
+    ASSERT_TRUE(WaitFor([&]() { return Client.IsHealthy(); }));
+
+    std::vector<std::string> Fingerprints;
+    std::chrono::steady_clock::time_point Start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(GetNESSaveFingerprints(GetTestLogger(), Client, {"synthetic-10-KGT", "synthetic-20-Emu"}, Fingerprints));
+    EXPECT_LT(std::chrono::steady_clock::now() - Start, std::chrono::milliseconds(350));
+    ASSERT_EQ(Fingerprints.size(), 2);
+    EXPECT_FALSE(Fingerprints[0].empty());
+    EXPECT_NE(Fingerprints[0], Fingerprints[1]);
+}
+
+
+}; // Close Namespace Tests
+}; // Close Namespace BG
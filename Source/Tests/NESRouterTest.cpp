@@ -0,0 +1,109 @@
+//=================================//
+// This file is part of BrainGenix //
+//=================================//
+
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <memory>
+#include <string>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+#include <gtest/gtest.h>
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <NESInteraction/NESRouter.h>
+#include <NESInteraction/NESSimHandle.h>
+#include <NESInteraction/NESDataFetch.h>
+
+#include <Config/Config.h>
+
+#include <TestNES.h>
+
+
+namespace BG {
+namespace Tests {
+
+
+/**
+ * Two local NES backends and a router configured with both.
+ */
+class NESRouterTest : public ::testing::Test {
+protected:
+    const int FirstPort_ = TEST_NES_BASE_PORT + 20;
+    const int SecondPort_ = TEST_NES_BASE_PORT + 21;
+
+    std::unique_ptr<NESEmulator::EmulatorServer> FirstNES_;
+    std::unique_ptr<NESEmulator::EmulatorServer> SecondNES_;
+    EVM::Config::Config Config_;
+    std::unique_ptr<NESRouter> Router_;
+
+    void SetUp() override {
+        FirstNES_ = StartTestNES(FirstPort_);
+        SecondNES_ = StartTestNES(SecondPort_);
+
+        Config_.NESBackends = {std::string(TEST_NES_HOST) + ":" + std::to_string(FirstPort_), std::string(TEST_NES_HOST) + ":" + std::to_string(SecondPort_)};
+        Config_.ConnectionPoolSize = 2;
+        Router_ = std::make_unique<NESRouter>(GetTestLogger(), Config_, nullptr);
+    }
+
+    /**
+     * Waits until both backends are connected, so placement is not skewed by health.
+     */
+    bool WaitForBackends() {
+        return WaitFor([this]() {
+            NESPlacement First(*Router_);
+            NESPlacement Second(*Router_);
+            return First.Client()->IsHealthy() && Second.Client()->IsHealthy();
+        });
+    }
+};
+
+
+TEST_F(NESRouterTest, SimulationsOfOneValidationGoToDifferentBackends) {
+    ASSERT_EQ(Router_->GetNumBackends(), 2);
+    ASSERT_TRUE(WaitForBackends());
+
+    NESPlacement KGT(*Router_);
+    SafeClient* EmuBackend = nullptr;
+    {
+        NESPlacement Emu(*Router_);
+        EmuBackend = Emu.Client();
+        EXPECT_NE(KGT.Client(), EmuBackend);
+    }
+
+    // The released backend is the least used one again
+    NESPlacement Next(*Router_);
+    EXPECT_EQ(Next.Client(), EmuBackend);
+}
+
+
+// Both backends number their simulations from 0, so a call sent to the wrong backend would read the other network
+TEST_F(NESRouterTest, CallsStickToTheOwningBackend) {
+    ASSERT_TRUE(WaitForBackends());
+
+    NESSimManager* Manager = Router_->GetSimManager();
+    SimHandle KGT = Manager->Acquire("synthetic-50-KGT", 10000);
+    SimHandle Emu = Manager->Acquire("synthetic-80-Emu", 10000);
+    ASSERT_TRUE(KGT.IsValid());
+    ASSERT_TRUE(Emu.IsValid());
+    EXPECT_NE(KGT.Sim().Client_, Emu.Sim().Client_);
+    EXPECT_EQ(KGT.Sim().SimID_, Emu.Sim().SimID_);
+
+    SimDataset KGTData;
+    SimDataset EmuData;
+    ASSERT_TRUE(FetchSimDataset(GetTestLogger(), KGT.Sim(), NES_DATA_SOMA_POSITIONS, KGTData));
+    ASSERT_TRUE(FetchSimDataset(GetTestLogger(), Emu.Sim(), NES_DATA_SOMA_POSITIONS, EmuData));
+    EXPECT_EQ(KGTData.SomaPositions_.size(), 50 * 3);
+    EXPECT_EQ(EmuData.SomaPositions_.size(), 80 * 3);
+
+    // A second user of the same save shares the loaded simulation on its backend
+    SimHandle KGTAgain = Manager->Acquire("synthetic-50-KGT", 10000);
+    ASSERT_TRUE(KGTAgain.IsValid());
+    EXPECT_EQ(KGTAgain.Sim().Client_, KGT.Sim().Client_);
+    EXPECT_EQ(KGTAgain.Sim().SimID_, KGT.Sim().SimID_);
+    EXPECT_EQ(Manager->GetNumLoaded(), 2);
+}
+
+
+}; // Close Namespace Tests
+}; // Close Namespace BG
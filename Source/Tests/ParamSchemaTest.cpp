@@ -0,0 +1,120 @@
+//=================================//
+// This file is part of BrainGenix //
+//=================================//
+
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <string>
+#include <vector>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+#include <gtest/gtest.h>
+
+#include <nlohmann/json.hpp>
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <RPC/ParamSchema.h>
+#include <Util/RequestArena.h>
+
+
+namespace BG {
+namespace Tests {
+
+
+/**
+ * Parameters of a made-up route, covering every kind of field.
+ */
+struct ExampleParams {
+    std::string Name;
+    int Count = -1;
+    float Scale = 1.0f;
+    bool Verbose = false;
+    std::vector<int> IDs;
+    std::vector<float> Weights;
+};
+
+static EVM::API::ParamSchema<ExampleParams> MakeSchema() {
+    EVM::API::ParamSchema<ExampleParams> Schema;
+    Schema.String("Name", &ExampleParams::Name)
+          .Int("Count", &ExampleParams::Count)
+          .Float("Scale", &ExampleParams::Scale, false)
+          .Bool("Verbose", &ExampleParams::Verbose, false)
+          .VecInt("IDs", &ExampleParams::IDs, false)
+          .VecFloat("Weights", &ExampleParams::Weights, false);
+    return Schema;
+}
+
+
+TEST(ParamSchema, NumberVectorsAreCopiedInBulk) {
+    ExampleParams Params;
+    nlohmann::json Errors = nlohmann::json::array();
+    EVM::Util::ArenaJSON Request = EVM::Util::ArenaJSON::parse("{\"Name\": \"a\", \"Count\": 3, \"IDs\": [4, -5, 6], \"Weights\": [0.5, 2, -1.25], \"Verbose\": true}");
+
+    ASSERT_TRUE(MakeSchema().Decode(Request, Params, Errors));
+    EXPECT_TRUE(Errors.empty());
+    EXPECT_EQ(Params.Name, "a");
+    EXPECT_EQ(Params.Count, 3);
+    EXPECT_TRUE(Params.Verbose);
+    EXPECT_EQ(Params.IDs, std::vector<int>({4, -5, 6}));
+    EXPECT_EQ(Params.Weights, std::vector<float>({0.5f, 2.0f, -1.25f}));
+
+    // Absent optional parameters keep their initial value
+    EXPECT_FLOAT_EQ(Params.Scale, 1.0f);
+}
+
+
+TEST(ParamSchema, TypeMismatchIsReportedPerParam) {
+    ExampleParams Params;
+    nlohmann::json Errors = nlohmann::json::array();
+    EVM::Util::ArenaJSON Request = EVM::Util::ArenaJSON::parse("{\"Name\": 7, \"Count\": 3, \"IDs\": [1, \"2\"], \"Weights\": 0.5}");
+
+    EXPECT_FALSE(MakeSchema().Decode(Request, Params, Errors));
+    ASSERT_EQ(Errors.size(), 3);
+    for (const nlohmann::json& Error : Errors) {
+        ASSERT_TRUE(Error.contains("Param"));
+        ASSERT_TRUE(Error.contains("Error"));
+        EXPECT_TRUE(Error["Param"] == "Name" || Error["Param"] == "IDs" || Error["Param"] == "Weights") << Error.dump();
+        EXPECT_FALSE(Error["Error"].get<std::string>().empty());
+    }
+    EXPECT_EQ(Params.Count, 3);
+}
+
+
+TEST(ParamSchema, MissingRequiredParamIsReported) {
+    ExampleParams Params;
+    nlohmann::json Errors = nlohmann::json::array();
+    EVM::Util::ArenaJSON Request = EVM::Util::ArenaJSON::parse("{\"Name\": \"a\", \"Scale\": 2}");
+
+    EXPECT_FALSE(MakeSchema().Decode(Request, Params, Errors));
+    ASSERT_EQ(Errors.size(), 1);
+    EXPECT_EQ(Errors[0]["Param"], "Count");
+    EXPECT_EQ(Errors[0]["Error"], "missing");
+    EXPECT_FLOAT_EQ(Params.Scale, 2.0f);
+}
+
+
+TEST(ParamSchema, NonObjectRequestIsRejected) {
+    for (const char* Text : {"[1, 2]", "\"Name\"", "null", "3"}) {
+        ExampleParams Params;
+        nlohmann::json Errors = nlohmann::json::array();
+        EXPECT_FALSE(MakeSchema().Decode(EVM::Util::ArenaJSON::parse(Text), Params, Errors)) << Text;
+        ASSERT_EQ(Errors.size(), 1) << Text;
+        EXPECT_EQ(Errors[0]["Param"], "");
+        EXPECT_EQ(Params.Count, -1);
+    }
+}
+
+
+TEST(ParamSchema, UnknownKeysAreIgnored) {
+    ExampleParams Params;
+    nlohmann::json Errors = nlohmann::json::array();
+    EVM::Util::ArenaJSON Request = EVM::Util::ArenaJSON::parse("{\"Name\": \"a\", \"Count\": 1, \"Extra\": [\"not\", \"checked\"], \"count\": \"x\"}");
+
+    EXPECT_TRUE(MakeSchema().Decode(Request, Params, Errors));
+    EXPECT_TRUE(Errors.empty());
+    EXPECT_EQ(Params.Count, 1);
+}
+
+
+}; // Close Namespace Tests
+}; // Close Namespace BG
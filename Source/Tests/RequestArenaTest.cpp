@@ -0,0 +1,81 @@
+//=================================//
+// This file is part of BrainGenix //
+//=================================//
+
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+#include <gtest/gtest.h>
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <Util/RequestArena.h>
+
+
+namespace BG {
+namespace Tests {
+
+
+TEST(RequestArena, AllocationsAreAlignedAndGrowPastTheFirstBlock) {
+    EVM::Util::RequestArena Arena(128);
+    for (size_t Size : {1, 7, 16, 100, 500, 3}) {
+        void* Pointer = Arena.Allocate(Size);
+        ASSERT_NE(Pointer, nullptr);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(Pointer) % alignof(std::max_align_t), 0);
+    }
+    EXPECT_GE(Arena.GetBytesAllocated(), 627);
+}
+
+
+TEST(RequestArena, ScopedArenaIsRestored) {
+    EVM::Util::RequestArena Outer;
+    EVM::Util::RequestArena Inner;
+    EXPECT_EQ(EVM::Util::RequestArena::Current(), nullptr);
+    {
+        EVM::Util::ScopedRequestArena OuterScope(Outer);
+        EXPECT_EQ(EVM::Util::RequestArena::Current(), &Outer);
+        {
+            EVM::Util::ScopedRequestArena InnerScope(Inner);
+            EXPECT_EQ(EVM::Util::RequestArena::Current(), &Inner);
+        }
+        EXPECT_EQ(EVM::Util::RequestArena::Current(), &Outer);
+    }
+    EXPECT_EQ(EVM::Util::RequestArena::Current(), nullptr);
+}
+
+
+TEST(RequestArena, ParsedJSONComesFromTheArena) {
+    EVM::Util::RequestArena Arena;
+    EVM::Util::ScopedRequestArena Scope(Arena);
+
+    EVM::Util::ArenaJSON Request = EVM::Util::ArenaJSON::parse("[{\"ReqID\": 0, \"Debug/Echo\": {\"Name\": \"a fairly long string that is not stored inline\"}}]");
+    EXPECT_GT(Arena.GetBytesAllocated(), 0);
+    EXPECT_EQ(Request[0]["Debug/Echo"]["Name"], "a fairly long string that is not stored inline");
+}
+
+
+// Without a current arena the allocator uses the heap, so such values may be freed on any thread
+TEST(RequestArena, HeapValuesMayBeFreedOnAnotherThread) {
+    std::unique_ptr<EVM::Util::ArenaJSON> Value = std::make_unique<EVM::Util::ArenaJSON>(EVM::Util::ArenaJSON::parse("{\"Items\": [1, 2, 3]}"));
+    EXPECT_EQ((*Value)["Items"].size(), 3);
+
+    // Arena memory is also fine to "free" elsewhere, it is simply left to the arena
+    EVM::Util::RequestArena Arena;
+    std::unique_ptr<EVM::Util::ArenaJSON> ArenaValue;
+    {
+        EVM::Util::ScopedRequestArena Scope(Arena);
+        ArenaValue = std::make_unique<EVM::Util::ArenaJSON>(EVM::Util::ArenaJSON::parse("{\"Items\": [4, 5]}"));
+    }
+    std::thread([&Value, &ArenaValue]() { Value.reset(); ArenaValue.reset(); }).join();
+    EXPECT_EQ(Value, nullptr);
+    EXPECT_EQ(ArenaValue, nullptr);
+}
+
+
+}; // Close Namespace Tests
+}; // Close Namespace BG
@@ -0,0 +1,92 @@
+//=================================//
+// This file is part of BrainGenix //
+//=================================//
+
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <stdexcept>
+#include <string>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+#include <gtest/gtest.h>
+
+#include <nlohmann/json.hpp>
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <RPC/RequestCache.h>
+
+
+namespace BG {
+namespace Tests {
+
+
+TEST(RequestCache, RetryGetsStoredResponse) {
+    EVM::API::RequestCache Cache(16, 60000);
+    int Runs = 0;
+    auto Compute = [&Runs]() { Runs++; return nlohmann::json(Runs); };
+
+    EXPECT_EQ(Cache.GetOrCompute("EVM/A", Compute), 1);
+    EXPECT_EQ(Cache.GetOrCompute("EVM/A", Compute), 1);
+    EXPECT_EQ(Runs, 1);
+
+    EXPECT_EQ(Cache.GetOrCompute("EVM/B", Compute), 2);
+    EXPECT_EQ(Runs, 2);
+}
+
+
+TEST(RequestCache, ForgottenKeyIsRunAgain) {
+    EVM::API::RequestCache Cache(16, 60000);
+    int Runs = 0;
+    auto Compute = [&Runs]() { Runs++; return nlohmann::json(Runs); };
+
+    Cache.GetOrCompute("EVM/A", Compute);
+    Cache.Forget("EVM/A");
+    EXPECT_EQ(Cache.GetOrCompute("EVM/A", Compute), 2);
+    EXPECT_EQ(Runs, 2);
+}
+
+
+// The oldest key is dropped first, a key that was forgotten and added again counts as new
+TEST(RequestCache, ReaddedKeyIsNotEvictedAsOldest) {
+    EVM::API::RequestCache Cache(3, 60000);
+    int Runs = 0;
+    auto Compute = [&Runs]() { Runs++; return nlohmann::json(Runs); };
+
+    Cache.GetOrCompute("EVM/A", Compute);   // Runs = 1
+    Cache.GetOrCompute("EVM/B", Compute);   // Runs = 2
+    Cache.GetOrCompute("EVM/C", Compute);   // Runs = 3
+    Cache.Forget("EVM/B");
+    Cache.GetOrCompute("EVM/B", Compute);   // Runs = 4, now newer than C
+    Cache.GetOrCompute("EVM/D", Compute);   // Runs = 5
+    Cache.GetOrCompute("EVM/E", Compute);   // Runs = 6, A and then C are the oldest
+
+    EXPECT_EQ(Cache.GetOrCompute("EVM/B", Compute), 4);
+    EXPECT_EQ(Cache.GetOrCompute("EVM/D", Compute), 5);
+    EXPECT_EQ(Cache.GetOrCompute("EVM/E", Compute), 6);
+    EXPECT_EQ(Cache.GetOrCompute("EVM/C", Compute), 7);
+}
+
+
+TEST(RequestCache, FailedComputationIsNotRemembered) {
+    EVM::API::RequestCache Cache(16, 60000);
+
+    EXPECT_THROW(Cache.GetOrCompute("EVM/A", []() -> nlohmann::json { throw std::runtime_error("failed"); }), std::runtime_error);
+    EXPECT_EQ(Cache.GetOrCompute("EVM/A", []() { return nlohmann::json(7); }), 7);
+}
+
+
+
+// A failing request that was forgotten meanwhile must not take the entry of the request that replaced it
+TEST(RequestCache, FailureKeepsReplacementEntry) {
+    EVM::API::RequestCache Cache(16, 60000);
+
+    EXPECT_THROW(Cache.GetOrCompute("EVM/A", [&Cache]() -> nlohmann::json {
+        Cache.Forget("EVM/A");
+        EXPECT_EQ(Cache.GetOrCompute("EVM/A", []() { return nlohmann::json(7); }), 7);
+        throw std::runtime_error("failed");
+    }), std::runtime_error);
+    EXPECT_EQ(Cache.GetOrCompute("EVM/A", []() { return nlohmann::json(8); }), 7);
+}
+
+}; // Close Namespace Tests
+}; // Close Namespace BG
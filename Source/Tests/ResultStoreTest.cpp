@@ -0,0 +1,111 @@
+//=================================//
+// This file is part of BrainGenix //
+//=================================//
+
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <chrono>
+#include <thread>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+#include <gtest/gtest.h>
+
+#include <nlohmann/json.hpp>
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <RPC/ResultStore.h>
+#include <RPC/APIStatusCode.h>
+
+
+namespace BG {
+namespace Tests {
+
+
+static nlohmann::json MakeItems(int _Count) {
+    nlohmann::json Items = nlohmann::json::array();
+    for (int i = 0; i < _Count; i++) {
+        Items.push_back({{"Neuron", i}});
+    }
+    return Items;
+}
+
+
+TEST(ResultStore, PagesAreReadUntilReleased) {
+    EVM::API::ResultStore Store(4, 60000);
+    int Handle = Store.Store(MakeItems(5));
+
+    nlohmann::json First = Store.GetPage(Handle, 0, 2);
+    EXPECT_EQ(First["StatusCode"], EVM::API::BGStatusSuccess);
+    EXPECT_EQ(First["TotalItems"], 5);
+    ASSERT_EQ(First["Items"].size(), 2);
+    EXPECT_EQ(First["Items"][1]["Neuron"], 1);
+    EXPECT_EQ(First["NextCursor"], 2);
+
+    nlohmann::json Last = Store.GetPage(Handle, 4, 2);
+    ASSERT_EQ(Last["Items"].size(), 1);
+    EXPECT_EQ(Last["Items"][0]["Neuron"], 4);
+    EXPECT_EQ(Last["NextCursor"], -1);
+
+    // A lost page can be read again
+    EXPECT_EQ(Store.GetPage(Handle, 4, 2)["Items"], Last["Items"]);
+
+    EXPECT_TRUE(Store.Release(Handle));
+    EXPECT_FALSE(Store.Release(Handle));
+    EXPECT_EQ(Store.GetPage(Handle, 0, 2)["StatusCode"], EVM::API::BGStatusInvalidParametersPassed);
+}
+
+
+TEST(ResultStore, CursorPastTheEndIsRejected) {
+    EVM::API::ResultStore Store(4, 60000);
+    int Handle = Store.Store(MakeItems(3));
+
+    // Right at the end is an empty last page, beyond it is an error
+    nlohmann::json AtEnd = Store.GetPage(Handle, 3, 10);
+    EXPECT_EQ(AtEnd["StatusCode"], EVM::API::BGStatusSuccess);
+    EXPECT_TRUE(AtEnd["Items"].empty());
+    EXPECT_EQ(AtEnd["NextCursor"], -1);
+
+    EXPECT_EQ(Store.GetPage(Handle, 4, 10)["StatusCode"], EVM::API::BGStatusInvalidParametersPassed);
+    EXPECT_EQ(Store.GetPage(Handle, -1, 10)["StatusCode"], EVM::API::BGStatusInvalidParametersPassed);
+    EXPECT_EQ(Store.GetPage(Handle, 0, 0)["StatusCode"], EVM::API::BGStatusInvalidParametersPassed);
+
+    // Empty results have a single empty page
+    int Empty = Store.Store(MakeItems(0));
+    EXPECT_EQ(Store.GetPage(Empty, 0, 10)["StatusCode"], EVM::API::BGStatusSuccess);
+    EXPECT_EQ(Store.GetPage(Empty, 1, 10)["StatusCode"], EVM::API::BGStatusInvalidParametersPassed);
+}
+
+
+TEST(ResultStore, UntouchedResultsExpire) {
+    EVM::API::ResultStore Store(4, 100);
+    int Stale = Store.Store(MakeItems(2));
+    int Active = Store.Store(MakeItems(2));
+
+    // Reading a page counts as a touch
+    for (int i = 0; i < 3; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        EXPECT_EQ(Store.GetPage(Active, 0, 1)["StatusCode"], EVM::API::BGStatusSuccess);
+    }
+    EXPECT_EQ(Store.GetPage(Stale, 0, 1)["StatusCode"], EVM::API::BGStatusInvalidParametersPassed);
+    EXPECT_FALSE(Store.Release(Stale));
+    EXPECT_TRUE(Store.Release(Active));
+}
+
+
+TEST(ResultStore, OldestResultIsEvictedFirst) {
+    EVM::API::ResultStore Store(2, 60000);
+    int First = Store.Store(MakeItems(1));
+    int Second = Store.Store(MakeItems(1));
+
+    // Touching the oldest one does not save it, eviction follows the order of storing
+    EXPECT_EQ(Store.GetPage(First, 0, 1)["StatusCode"], EVM::API::BGStatusSuccess);
+    int Third = Store.Store(MakeItems(1));
+
+    EXPECT_EQ(Store.GetPage(First, 0, 1)["StatusCode"], EVM::API::BGStatusInvalidParametersPassed);
+    EXPECT_EQ(Store.GetPage(Second, 0, 1)["StatusCode"], EVM::API::BGStatusSuccess);
+    EXPECT_EQ(Store.GetPage(Third, 0, 1)["StatusCode"], EVM::API::BGStatusSuccess);
+}
+
+
+}; // Close Namespace Tests
+}; // Close Namespace BG
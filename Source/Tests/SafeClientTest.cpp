@@ -0,0 +1,277 @@
+//=================================//
+// This file is part of BrainGenix //
+//=================================//
+
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+#include <gtest/gtest.h>
+
+#include <nlohmann/json.hpp>
+#include <rpc/server.h>
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <RPC/SafeClient.h>
+
+#include <Version.h>
+
+#include <TestNES.h>
+
+
+namespace BG {
+namespace Tests {
+
+
+/**
+ * Upstream service that counts how often each route is called, every reply takes _Delay_ms.
+ */
+class CountingService {
+private:
+    rpc::server Server_;
+public:
+    std::atomic<int> GetCalls_{0};
+    std::atomic<int> StatusCalls_{0};
+
+    CountingService(int _Port, int _Delay_ms) : Server_(TEST_NES_HOST, _Port) {
+        Server_.bind("GetAPIVersion", []() { return std::string(VERSION); });
+        Server_.bind("Simulation/GetSomaPositions", [this, _Delay_ms](std::string _Request) {
+            GetCalls_++;
+            std::this_thread::sleep_for(std::chrono::milliseconds(_Delay_ms));
+            return std::string("[{\"ReqID\":0,\"StatusCode\":0}]");
+        });
+        Server_.bind("", [this, _Delay_ms](std::string _Request) {
+            StatusCalls_++;
+            std::this_thread::sleep_for(std::chrono::milliseconds(_Delay_ms));
+            return std::string("{\"StatusCode\":0}");
+        });
+        Server_.async_run(4);
+    }
+};
+
+/**
+ * Upstream service that answers within a few ms, except for the call numbered StallCall_ which takes _Stall_ms.
+ */
+class StallingService {
+private:
+    rpc::server Server_;
+public:
+    std::atomic<int> Calls_{0};
+    std::atomic<int> StallCall_{-1};
+
+    StallingService(int _Port, int _Stall_ms) : Server_(TEST_NES_HOST, _Port) {
+        Server_.bind("GetAPIVersion", []() { return std::string(VERSION); });
+        Server_.bind("Simulation/GetSomaPositions", [this, _Stall_ms](std::string _Request) {
+            int Call = Calls_++;
+            std::this_thread::sleep_for(std::chrono::milliseconds(Call == StallCall_ ? _Stall_ms : 2));
+            return std::string("[{\"ReqID\":0,\"StatusCode\":0}]");
+        });
+        Server_.async_run(4);
+    }
+};
+
+/**
+ * Sends all queries at the same time and returns how many succeeded.
+ */
+static int QueryConcurrently(SafeClient& _Client, const std::string& _Route, const std::vector<std::string>& _Queries) {
+    std::vector<std::future<bool>> Calls;
+    for (const std::string& Query : _Queries) {
+        Calls.push_back(std::async(std::launch::async, [&_Client, &_Route, Query]() {
+            std::string Result;
+            return _Client.MakeJSONQuery(_Route, Query, &Result);
+        }));
+    }
+    int Succeeded = 0;
+    for (std::future<bool>& Call : Calls) {
+        Succeeded += Call.get() ? 1 : 0;
+    }
+    return Succeeded;
+}
+
+
+// A caller waiting for the only connection must not hang when that connection turns out
+// to be stale (Reconnect() was called meanwhile) at the moment it is handed back.
+TEST(SafeClientPool, ReconnectWhileWaitingForConnection) {
+    const int Port = TEST_NES_BASE_PORT + 0;
+    std::unique_ptr<NESEmulator::EmulatorServer> NES = StartTestNES(Port, 300);
+
+    SafeClient Client(GetTestLogger(), 1);
+    Client.SetTimeout(3000);
+    Client.SetHostPort(TEST_NES_HOST, Port);
+    ASSERT_TRUE(WaitFor([&]() { return Client.IsHealthy(); }));
+
+    // The first caller holds the connection for about 300ms
+    std::future<bool> Holder = std::async(std::launch::async, [&]() {
+        std::string Result;
+        return Client.MakeJSONQuery("Echo", "[]", &Result);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    // The second one has to wait for it
+    std::future<bool> Waiter = std::async(std::launch::async, [&]() {
+        std::string Result;
+        return Client.MakeJSONQuery("Echo", "[]", &Result);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    Client.Reconnect();
+
+    ASSERT_EQ(Holder.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    ASSERT_EQ(Waiter.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_TRUE(Holder.get());
+    Waiter.get(); // May fail, the only connection is being remade, but it must return
+
+    // The pool recovers once the manager thread has remade the connection
+    EXPECT_TRUE(WaitFor([&]() { return Client.IsHealthy(); }));
+    std::string Result;
+    EXPECT_TRUE(Client.MakeJSONQuery("Echo", "[]", &Result));
+}
+
+
+TEST(SafeClientSingleFlight, IdenticalReadOnlyQueriesShareOneRoundTrip) {
+    const int Port = TEST_NES_BASE_PORT + 1;
+    CountingService Service(Port, 200);
+
+    SafeClient Client(GetTestLogger(), 4);
+    Client.SetTimeout(3000);
+    Client.SetHostPort(TEST_NES_HOST, Port);
+    ASSERT_TRUE(WaitFor([&]() { return Client.IsHealthy(); }));
+
+    const std::string Query = "[{\"ReqID\":0,\"Simulation/GetSomaPositions\":{\"SimID\":0}}]";
+    EXPECT_EQ(QueryConcurrently(Client, "Simulation/GetSomaPositions", std::vector<std::string>(4, Query)), 4);
+    EXPECT_EQ(Service.GetCalls_.load(), 1);
+
+    // Different payloads are different queries
+    Service.GetCalls_ = 0;
+    std::vector<std::string> Distinct = {Query, Query + " ", Query + "  "};
+    EXPECT_EQ(QueryConcurrently(Client, "Simulation/GetSomaPositions", Distinct), 3);
+    EXPECT_EQ(Service.GetCalls_.load(), 3);
+}
+
+
+// Shared memory segments are handed to a single reader, so each caller needs its own reply
+TEST(SafeClientSingleFlight, SharedMemoryQueriesAreNotCoalesced) {
+    const int Port = TEST_NES_BASE_PORT + 3;
+    CountingService Service(Port, 200);
+
+    SafeClient Client(GetTestLogger(), 4);
+    Client.SetTimeout(3000);
+    Client.SetHostPort(TEST_NES_HOST, Port);
+    ASSERT_TRUE(WaitFor([&]() { return Client.IsHealthy(); }));
+
+    const std::string Query = "[{\"ReqID\":0,\"Simulation/GetSomaPositions\":{\"BulkTransport\":\"SHM\",\"SimID\":0}}]";
+    EXPECT_EQ(QueryConcurrently(Client, "Simulation/GetSomaPositions", std::vector<std::string>(4, Query)), 4);
+    EXPECT_EQ(Service.GetCalls_.load(), 4);
+}
+
+
+// The status reflects processes the caller has just started, so it must never be taken from an earlier query
+TEST(SafeClientSingleFlight, StatusQueriesAreNotCoalesced) {
+    const int Port = TEST_NES_BASE_PORT + 2;
+    CountingService Service(Port, 200);
+
+    SafeClient Client(GetTestLogger(), 4);
+    Client.SetTimeout(3000);
+    Client.SetHostPort(TEST_NES_HOST, Port);
+    ASSERT_TRUE(WaitFor([&]() { return Client.IsHealthy(); }));
+
+    EXPECT_EQ(QueryConcurrently(Client, "", std::vector<std::string>(4, "")), 4);
+    EXPECT_EQ(Service.StatusCalls_.load(), 4);
+}
+
+
+// Waiting for a busy connection uses up the caller's deadline, the call only gets what is left of it
+TEST(SafeClientPool, DeadlineCoversWaitForConnection) {
+    const int Port = TEST_NES_BASE_PORT + 6;
+    CountingService Service(Port, 200);
+
+    SafeClient Client(GetTestLogger(), 1);
+    Client.SetTimeout(3000);
+    Client.SetHostPort(TEST_NES_HOST, Port);
+    ASSERT_TRUE(WaitFor([&]() { return Client.IsHealthy(); }));
+
+    // The first caller holds the only connection for about 200ms
+    std::future<bool> First = std::async(std::launch::async, [&Client]() {
+        std::string Result;
+        return Client.MakeJSONQuery("", "", &Result);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    // About 150ms of waiting leave too little for another 200ms call
+    std::string Result;
+    std::chrono::steady_clock::time_point Start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(Client.MakeJSONQuery("", "", &Result, false, 250));
+    EXPECT_LT(std::chrono::steady_clock::now() - Start, std::chrono::milliseconds(320));
+    EXPECT_TRUE(First.get());
+}
+
+
+// A stalled reply is overtaken by the duplicate, and the waiter wakes as soon as that arrives
+TEST(SafeClientHedging, DuplicateAnswersStalledQuery) {
+    const int Port = TEST_NES_BASE_PORT + 4;
+    StallingService Service(Port, 2000);
+
+    SafeClient Client(GetTestLogger(), 4);
+    Client.SetTimeout(5000);
+    Client.SetHostPort(TEST_NES_HOST, Port);
+    Client.SetHedging(true);
+    ASSERT_TRUE(WaitFor([&]() { return Client.IsHealthy(); }));
+
+    // Teach the client what a normal reply time looks like
+    const std::string Query = "[{\"ReqID\":0,\"Simulation/GetSomaPositions\":{\"SimID\":0}}]";
+    std::string Result;
+    for (int i = 0; i < 40; i++) {
+        ASSERT_TRUE(Client.MakeJSONQuery("Simulation/GetSomaPositions", Query, &Result));
+    }
+    std::uint64_t HedgesBefore = Client.GetHedgeCount();
+
+    Service.StallCall_ = Service.Calls_.load();
+    std::chrono::steady_clock::time_point Start = std::chrono::steady_clock::now();
+    EXPECT_TRUE(Client.MakeJSONQuery("Simulation/GetSomaPositions", Query, &Result));
+    EXPECT_LT(std::chrono::steady_clock::now() - Start, std::chrono::milliseconds(1000));
+    EXPECT_EQ(Client.GetHedgeCount(), HedgesBefore + 1);
+}
+
+// Pipelined queries wait about one latency in total, keep their order, and a failing one only fails its own slot
+TEST(SafeClientPipelining, BatchTakesAboutOneRoundTrip) {
+    const int Port = TEST_NES_BASE_PORT + 5;
+    std::unique_ptr<NESEmulator::EmulatorServer> NES = StartTestNES(Port, 200);
+
+    SafeClient Client(GetTestLogger(), 1);
+    Client.SetTimeout(3000);
+    Client.SetHostPort(TEST_NES_HOST, Port);
+    ASSERT_TRUE(WaitFor([&]() { return Client.IsHealthy(); }));
+
+    std::vector<JSONQuery> Queries(4);
+    for (size_t i = 0; i < Queries.size(); i++) {
+        Queries[i].Route_ = "Echo";
+        Queries[i].Query_ = "[{\"ReqID\":" + std::to_string(i) + ",\"Echo\":{\"Slot\":" + std::to_string(i) + "}}]";
+    }
+    Queries[2].Route_ = "NoSuchRoute";
+
+    std::vector<QueryResult> Results;
+    std::chrono::steady_clock::time_point Start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(Client.MakeJSONQueries(Queries, Results));
+    EXPECT_LT(std::chrono::steady_clock::now() - Start, std::chrono::milliseconds(350));
+
+    ASSERT_EQ(Results.size(), Queries.size());
+    for (size_t i = 0; i < Results.size(); i++) {
+        if (i == 2) {
+            EXPECT_FALSE(Results[i].Success_);
+            continue;
+        }
+        ASSERT_TRUE(Results[i].Success_) << "slot " << i;
+        nlohmann::json Response = nlohmann::json::parse(Results[i].Response_);
+        EXPECT_EQ(Response[0]["Echo"]["Slot"], i);
+    }
+}
+
+
+}; // Close Namespace Tests
+}; // Close Namespace BG
@@ -0,0 +1,82 @@
+//=================================//
+// This file is part of BrainGenix //
+//=================================//
+
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <filesystem>
+#include <system_error>
+#include <thread>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <TestNES.h>
+
+
+
+namespace BG {
+namespace Tests {
+
+
+BG::Common::Logger::LoggingSystem* GetTestLogger() {
+    static BG::Common::Logger::LoggingSystem* Logger = []() {
+        BG::Common::Logger::LoggingSystem* NewLogger = new BG::Common::Logger::LoggingSystem;
+        NewLogger->SetKeepVectorLogs(false);
+        return NewLogger;
+    }();
+    return Logger;
+}
+
+std::unique_ptr<NESEmulator::EmulatorServer> StartTestNES(int _Port, int _Latency_ms, double _LoadTimePerNeuron_ms, int _SegmentTTL_ms) {
+    NESEmulator::EmulatorConfig Config;
+    Config.Host = TEST_NES_HOST;
+    Config.Port = _Port;
+    Config.Threads = 4;
+    Config.DefaultNeurons = 100;
+    Config.Latency_ms = _Latency_ms;
+    Config.LoadTimePerNeuron_ms = _LoadTimePerNeuron_ms;
+    Config.SegmentTTL_ms = _SegmentTTL_ms;
+    return std::make_unique<NESEmulator::EmulatorServer>(Config, GetTestLogger());
+}
+
+bool WaitFor(std::function<bool()> _Condition, int _Timeout_ms) {
+    std::chrono::steady_clock::time_point Deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(_Timeout_ms);
+    while (!_Condition()) {
+        if (std::chrono::steady_clock::now() >= Deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return true;
+}
+
+bool SharedMemoryExists(const std::string& _Name) {
+    int Descriptor = shm_open(_Name.c_str(), O_RDONLY, 0);
+    if (Descriptor < 0) {
+        return false;
+    }
+    close(Descriptor);
+    return true;
+}
+
+std::vector<std::string> GetTestNESSegments() {
+    // Segments show up as files below /dev/shm on Linux, the stand-ins name theirs "/bgnes-<pid>-<n>"
+    std::string Prefix = "bgnes-" + std::to_string(getpid()) + "-";
+    std::vector<std::string> Names;
+    std::error_code Error;
+    for (const std::filesystem::directory_entry& Entry : std::filesystem::directory_iterator("/dev/shm", Error)) {
+        std::string Name = Entry.path().filename().string();
+        if (Name.compare(0, Prefix.size(), Prefix) == 0) {
+            Names.push_back("/" + Name);
+        }
+    }
+    return Names;
+}
+
+
+}; // Close Namespace Tests
+}; // Close Namespace BG
@@ -0,0 +1,71 @@
+//=================================================================//
+// This file is part of the BrainGenix-EVM Neuron Emulation System //
+//=================================================================//
+
+/*
+    Description: This file provides helpers shared by the tests, e.g. local NES stand-in servers.
+    Additional Notes: None
+    Date Created: 2024-07-01
+*/
+
+#pragma once
+
+// Standard Libraries (BG convention: use <> instead of "")
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Third-Party Libraries (BG convention: use <> instead of "")
+
+// Internal Libraries (BG convention: use <> instead of "")
+#include <EmulatorServer.h>
+
+#include <BG/Common/Logger/Logger.h>
+
+
+
+namespace BG {
+namespace Tests {
+
+
+#define TEST_NES_HOST "127.0.0.1"
+#define TEST_NES_BASE_PORT 18700 /**Tests use ports from here on, each test its own*/
+
+
+/**
+ * @brief Returns the logger used by all tests, keeping no vector logs.
+ */
+BG::Common::Logger::LoggingSystem* GetTestLogger();
+
+/**
+ * @brief Starts a NES stand-in on 127.0.0.1:_Port, serving until the returned server is destroyed.
+ * 
+ * @param _Port 
+ * @param _Latency_ms Delay added to every reply.
+ * @param _LoadTimePerNeuron_ms Time a Simulation/Load stays busy per neuron.
+ * @param _SegmentTTL_ms Time after which shared memory segments nobody picked up are removed.
+ * @return std::unique_ptr<NESEmulator::EmulatorServer> 
+ */
+std::unique_ptr<NESEmulator::EmulatorServer> StartTestNES(int _Port, int _Latency_ms = 0, double _LoadTimePerNeuron_ms = 0.0, int _SegmentTTL_ms = 60000);
+
+/**
+ * @brief Polls _Condition until it holds or _Timeout_ms passed.
+ * @return true if the condition held in time.
+ */
+bool WaitFor(std::function<bool()> _Condition, int _Timeout_ms = 5000);
+
+/**
+ * @brief Returns true if a shared memory segment of that name exists (has not been unlinked).
+ */
+bool SharedMemoryExists(const std::string& _Name);
+
+/**
+ * @brief Returns the names of the shared memory segments the NES stand-ins of this process currently have linked.
+ */
+std::vector<std::string> GetTestNESSegments();
+
+
+}; // Close Namespace Tests
+}; // Close Namespace BG
@@ -0,0 +1,8 @@
+#!/bin/bash
+
+# Enter Artifact/Binary Dir
+cd ..
+cd Binaries
+
+# Start The NES Stand-In (e.g. ./RunNESEmulator.sh --Port 8001 --Latency_ms 2)
+./BrainGenix-NESEmulator "$@"